@@ -196,6 +196,30 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+// @brief message for load mode option
+static const char load_mode_message[] =
+    "Optional. Load generation mode. 'closed' (default) keeps all the infer requests busy. "
+    "Open-loop modes issue requests at their arrival times regardless of the completions: "
+    "'constant' - with the fixed rate set by -rate, 'poisson' - with Poisson arrivals of the mean rate set by -rate, "
+    "'trace' - replaying the arrival times from the -trace file. "
+    "Open-loop modes report the queueing delay separately from the execution time. Requires -api async.";
+
+// @brief message for request rate option
+static const char rate_message[] =
+    "Optional. Requests per second for the 'constant' and 'poisson' load modes. Together with -slo_p99 it is the upper "
+    "bound of the searched rate (estimated from the device capacity if not set).";
+
+// @brief message for arrival trace option
+static const char trace_message[] =
+    "Optional. Path to a text file with the request arrival times in milliseconds, one per line, for the 'trace' "
+    "load mode.";
+
+// @brief message for latency SLO option
+static const char slo_p99_message[] =
+    "Optional. Target 99th percentile of the end-to-end latency in milliseconds. With the 'constant' or 'poisson' "
+    "load mode searches for the maximum request rate meeting it, then measures the run at that rate. Each probe "
+    "runs for the -t duration (3 seconds if not set).";
+
 // @brief message for report_type option
 static const char report_type_message[] =
     "Optional. Enable collecting statistics report. \"no_counters\" report contains "
@@ -355,6 +379,18 @@ DEFINE_bool(use_device_mem, false, use_device_mem_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint64(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Load generation mode
+DEFINE_string(load_mode, "closed", load_mode_message);
+
+/// @brief Request rate of the open-loop load
+DEFINE_double(rate, 0.0, rate_message);
+
+/// @brief Path to a file with the request arrival times
+DEFINE_string(trace, "", trace_message);
+
+/// @brief Target 99th percentile of the end-to-end latency
+DEFINE_double(slo_p99, 0.0, slo_p99_message);
+
 /// @brief Enables statistics report collecting
 DEFINE_string(report_type, "", report_type_message);
 
@@ -429,6 +465,12 @@ static void show_usage() {
 #ifdef HAVE_DEVICE_MEM_SUPPORT
     std::cout << "    -use_device_mem           " << use_device_mem_message << std::endl;
 #endif
+    std::cout << std::endl;
+    std::cout << "Load generation options:" << std::endl;
+    std::cout << "    -load_mode  <mode>      " << load_mode_message << std::endl;
+    std::cout << "    -rate  <double>         " << rate_message << std::endl;
+    std::cout << "    -trace  <path>          " << trace_message << std::endl;
+    std::cout << "    -slo_p99  <double>      " << slo_p99_message << std::endl;
     std::cout << std::endl;
     std::cout << "Statistics dumping options:" << std::endl;
     std::cout << "    -latency_percentile     " << infer_latency_percentile_message << std::endl;
@@ -23,7 +23,8 @@
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency, const std::exception_ptr& ptr)>
+typedef std::function<
+    void(size_t id, size_t group_id, const double latency, const double queueing, const std::exception_ptr& ptr)>
     QueueCallbackFunction;
 
 /// @brief Handles asynchronous callbacks and calculates execution time
@@ -41,12 +42,24 @@ public:
           outputClBuffer() {
         _request.set_callback([&](const std::exception_ptr& ptr) {
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), ptr);
+            _callbackQueue(_id,
+                           _lat_group_id,
+                           get_execution_time_in_milliseconds(),
+                           get_queueing_time_in_milliseconds(),
+                           ptr);
         });
     }
 
     void start_async() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.start_async();
+    }
+
+    /// @brief Starts the request which arrived at the given time, the time till the start is reported as queueing
+    void start_async(Time::time_point arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.start_async();
     }
 
@@ -56,9 +69,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
+        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), 0.0, nullptr);
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -83,6 +97,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queueing_time_in_milliseconds() const {
+        auto queueTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -96,6 +115,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -116,7 +136,8 @@ public:
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
                                                                         std::placeholders::_3,
-                                                                        std::placeholders::_4)));
+                                                                        std::placeholders::_4,
+                                                                        std::placeholders::_5)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
@@ -137,6 +158,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueing_latencies.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -149,12 +171,14 @@ public:
     void put_idle_request(size_t id,
                           size_t lat_group_id,
                           const double latency,
+                          const double queueing,
                           const std::exception_ptr& ptr = nullptr) {
         std::unique_lock<std::mutex> lock(_mutex);
         if (ptr) {
             inferenceException = ptr;
         } else {
             _latencies.push_back(latency);
+            _queueing_latencies.push_back(queueing);
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
@@ -192,6 +216,11 @@ public:
         return _latencies;
     }
 
+    /// @brief Time spent by the requests between their arrival and start, aligned with get_latencies()
+    std::vector<double> get_queueing_latencies() {
+        return _queueing_latencies;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -205,6 +234,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueing_latencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
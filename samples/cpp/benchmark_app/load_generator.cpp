@@ -0,0 +1,243 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "load_generator.hpp"
+// clang-format on
+
+namespace benchmark_app {
+
+LoadMode parse_load_mode(const std::string& mode) {
+    if (mode == "closed")
+        return LoadMode::CLOSED;
+    if (mode == "constant")
+        return LoadMode::CONSTANT;
+    if (mode == "poisson")
+        return LoadMode::POISSON;
+    if (mode == "trace")
+        return LoadMode::TRACE;
+    throw std::logic_error("Incorrect load mode " + mode +
+                           ". Please set -load_mode option to `closed`, `constant`, `poisson` or `trace` value.");
+}
+
+std::string load_mode_to_string(LoadMode mode) {
+    switch (mode) {
+    case LoadMode::CLOSED:
+        return "closed";
+    case LoadMode::CONSTANT:
+        return "constant";
+    case LoadMode::POISSON:
+        return "poisson";
+    case LoadMode::TRACE:
+        return "trace";
+    }
+    return "";
+}
+
+ArrivalSchedule::ArrivalSchedule(LoadMode mode, double rate, const std::string& trace_file, uint32_t seed)
+    : _mode(mode),
+      _rate(rate),
+      _generator(seed),
+      _interval(rate > 0 ? rate / 1000.0 : 1.0) {
+    if (_mode == LoadMode::CLOSED) {
+        throw std::logic_error("Arrival schedule is defined for the open-loop load modes only");
+    }
+    if (_mode == LoadMode::TRACE) {
+        std::ifstream trace(trace_file);
+        if (!trace.is_open()) {
+            throw std::logic_error("Cannot open the arrival trace file " + trace_file);
+        }
+        double arrival_ms = 0.0;
+        while (trace >> arrival_ms) {
+            _trace.push_back(arrival_ms);
+        }
+        if (_trace.empty()) {
+            throw std::logic_error("The arrival trace file " + trace_file + " contains no arrival times");
+        }
+        std::sort(_trace.begin(), _trace.end());
+        const double span_ms = _trace.back() - _trace.front();
+        _rate = span_ms > 0 ? 1000.0 * (_trace.size() - 1) / span_ms : 0.0;
+    } else if (_rate <= 0) {
+        throw std::logic_error("Request rate must be positive for the " + load_mode_to_string(_mode) +
+                               " load mode. Please set -rate option.");
+    }
+}
+
+bool ArrivalSchedule::next(double& arrival_ms) {
+    switch (_mode) {
+    case LoadMode::CONSTANT:
+        arrival_ms = _index++ * 1000.0 / _rate;
+        return true;
+    case LoadMode::POISSON:
+        arrival_ms = _last_ms;
+        _last_ms += _interval(_generator);
+        return true;
+    case LoadMode::TRACE:
+        if (_index == _trace.size())
+            return false;
+        // the trace is replayed relative to its first arrival
+        arrival_ms = _trace[_index++] - _trace.front();
+        return true;
+    default:
+        return false;
+    }
+}
+
+LatencyHistogram::LatencyHistogram(std::vector<double> latencies, const std::string& name)
+    : _name(name),
+      _sorted(std::move(latencies)) {
+    if (_sorted.empty()) {
+        throw std::logic_error("Latency histogram expects non-empty vector of latencies at construction.");
+    }
+    std::sort(_sorted.begin(), _sorted.end());
+    _avg = std::accumulate(_sorted.begin(), _sorted.end(), 0.0) / _sorted.size();
+}
+
+double LatencyHistogram::percentile(double p) const {
+    // nearest-rank percentile
+    const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * _sorted.size()));
+    return _sorted[std::min(std::max<size_t>(rank, 1), _sorted.size()) - 1];
+}
+
+void LatencyHistogram::write_to_slog() const {
+    slog::info << _name << ":" << slog::endl;
+    slog::info << "   P50:              " << double_to_string(percentile(50)) << " ms" << slog::endl;
+    slog::info << "   P90:              " << double_to_string(percentile(90)) << " ms" << slog::endl;
+    slog::info << "   P99:              " << double_to_string(percentile(99)) << " ms" << slog::endl;
+    slog::info << "   P99.9:            " << double_to_string(percentile(99.9)) << " ms" << slog::endl;
+    slog::info << "   Average:          " << double_to_string(_avg) << " ms" << slog::endl;
+    slog::info << "   Min:              " << double_to_string(_sorted.front()) << " ms" << slog::endl;
+    slog::info << "   Max:              " << double_to_string(_sorted.back()) << " ms" << slog::endl;
+
+    // log2-scaled buckets starting from the power of two below the minimum
+    const double min_bound = 0.001;
+    double bound = std::pow(2.0, std::floor(std::log2(std::max(_sorted.front(), min_bound))));
+    auto begin = _sorted.begin();
+    slog::info << "   Histogram:" << slog::endl;
+    while (begin != _sorted.end()) {
+        bound *= 2;
+        auto end = std::upper_bound(begin, _sorted.end(), bound);
+        const auto count = static_cast<size_t>(std::distance(begin, end));
+        if (count > 0) {
+            slog::info << "      <= " << double_to_string(bound) << " ms: " << count << " ("
+                       << double_to_string(100.0 * count / _sorted.size()) << "%)" << slog::endl;
+        }
+        begin = end;
+    }
+}
+
+StatisticsReport::Parameters LatencyHistogram::to_statistics(const std::string& json_prefix) const {
+    return {StatisticsVariant(_name + " P50 (ms)", json_prefix + "_p50", percentile(50)),
+            StatisticsVariant(_name + " P90 (ms)", json_prefix + "_p90", percentile(90)),
+            StatisticsVariant(_name + " P99 (ms)", json_prefix + "_p99", percentile(99)),
+            StatisticsVariant(_name + " P99.9 (ms)", json_prefix + "_p99_9", percentile(99.9)),
+            StatisticsVariant(_name + " average (ms)", json_prefix + "_avg", _avg),
+            StatisticsVariant(_name + " min (ms)", json_prefix + "_min", _sorted.front()),
+            StatisticsVariant(_name + " max (ms)", json_prefix + "_max", _sorted.back())};
+}
+
+OpenLoopResult run_open_loop(InferRequestsQueue& queue,
+                             ArrivalSchedule& schedule,
+                             uint64_t niter,
+                             uint64_t duration_ns,
+                             const PrepareRequestFunction& prepare) {
+    OpenLoopResult result;
+    queue.reset_times();
+
+    const auto start_time = Time::now();
+    double arrival_ms = 0.0;
+    while ((niter == 0 || result.iterations < niter) && schedule.next(arrival_ms)) {
+        const auto arrival_time =
+            start_time + std::chrono::duration_cast<Time::duration>(std::chrono::duration<double, std::milli>(arrival_ms));
+        // an overloaded run may fall behind the schedule, so the wall time is limited as well
+        if (duration_ns != 0 &&
+            (static_cast<uint64_t>(std::chrono::duration_cast<ns>(arrival_time - start_time).count()) >= duration_ns ||
+             static_cast<uint64_t>(std::chrono::duration_cast<ns>(Time::now() - start_time).count()) >= duration_ns)) {
+            break;
+        }
+        std::this_thread::sleep_until(arrival_time);
+
+        // blocks while all the requests are busy, the wait is accounted as queueing delay
+        auto request = queue.get_idle_request();
+        if (prepare) {
+            prepare(request, result.iterations);
+        }
+        request->start_async(arrival_time);
+        ++result.iterations;
+    }
+    queue.wait_all();
+
+    result.duration_ms = queue.get_duration_in_milliseconds();
+    result.offered_rate = schedule.get_rate();
+    result.achieved_rate = result.duration_ms > 0 ? 1000.0 * result.iterations / result.duration_ms : 0.0;
+    result.execution = queue.get_latencies();
+    result.queueing = queue.get_queueing_latencies();
+    result.total.resize(result.execution.size());
+    std::transform(result.execution.begin(),
+                   result.execution.end(),
+                   result.queueing.begin(),
+                   result.total.begin(),
+                   std::plus<double>());
+    return result;
+}
+
+double find_max_rate_under_slo(InferRequestsQueue& queue,
+                               LoadMode mode,
+                               double slo_p99_ms,
+                               double max_rate,
+                               uint64_t probe_duration_ns,
+                               const PrepareRequestFunction& prepare) {
+    if (mode != LoadMode::CONSTANT && mode != LoadMode::POISSON) {
+        throw std::logic_error("The SLO search is supported for the `constant` and `poisson` load modes only");
+    }
+
+    if (max_rate <= 0) {
+        // saturating probe: all the requests arrive at once, so the achieved rate is the device capacity
+        ArrivalSchedule saturating(LoadMode::CONSTANT, 1e9);
+        max_rate = run_open_loop(queue, saturating, 0, probe_duration_ns, prepare).achieved_rate;
+        slog::info << "Estimated capacity: " << double_to_string(max_rate) << " requests/s" << slog::endl;
+    }
+
+    auto meets_slo = [&](double rate) {
+        ArrivalSchedule schedule(mode, rate);
+        const auto result = run_open_loop(queue, schedule, 0, probe_duration_ns, prepare);
+        if (result.total.empty())
+            return false;
+        const double p99 = LatencyHistogram(result.total, "").percentile(99);
+        // the queue grows without bound when the device cannot keep up with the offered rate
+        const bool sustained = result.achieved_rate >= 0.95 * rate;
+        const bool ok = sustained && p99 <= slo_p99_ms;
+        slog::info << "   rate " << double_to_string(rate) << " requests/s: P99 " << double_to_string(p99)
+                   << " ms, achieved " << double_to_string(result.achieved_rate) << " requests/s"
+                   << (ok ? "" : " - SLO violated") << slog::endl;
+        return ok;
+    };
+
+    slog::info << "Searching for the maximum rate with P99 latency under " << double_to_string(slo_p99_ms) << " ms"
+               << slog::endl;
+    if (meets_slo(max_rate))
+        return max_rate;
+
+    double low = 0.0, high = max_rate;
+    const size_t max_probes = 10;
+    for (size_t probe = 0; probe < max_probes && (high - low) > 0.02 * high; ++probe) {
+        const double rate = (low + high) / 2;
+        if (meets_slo(rate)) {
+            low = rate;
+        } else {
+            high = rate;
+        }
+    }
+    return low;
+}
+
+}  // namespace benchmark_app
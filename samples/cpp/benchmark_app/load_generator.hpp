@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "infer_request_wrap.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace benchmark_app {
+
+/// @brief How the requests are issued
+enum class LoadMode {
+    CLOSED,    // every completed request is immediately reused, all the requests are kept busy
+    CONSTANT,  // open loop, requests arrive with the fixed interval
+    POISSON,   // open loop, requests arrive with the exponentially distributed intervals
+    TRACE,     // open loop, arrival times are replayed from a file
+};
+
+LoadMode parse_load_mode(const std::string& mode);
+
+std::string load_mode_to_string(LoadMode mode);
+
+/// @brief Generates the arrival times of the open-loop load
+class ArrivalSchedule {
+public:
+    /// @param rate mean number of requests per second for the CONSTANT and POISSON modes
+    /// @param trace_file file with arrival times in milliseconds from the run start, one per line, for the TRACE mode
+    ArrivalSchedule(LoadMode mode, double rate, const std::string& trace_file = "", uint32_t seed = 42);
+
+    /// @brief Provides the next arrival time in milliseconds from the run start
+    /// @return false when the trace is exhausted
+    bool next(double& arrival_ms);
+
+    double get_rate() const {
+        return _rate;
+    }
+
+private:
+    LoadMode _mode;
+    double _rate;
+    double _last_ms = 0.0;
+    size_t _index = 0;
+    std::vector<double> _trace;
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _interval;
+};
+
+/// @brief Latency distribution of a run: percentiles and a log-scaled histogram
+class LatencyHistogram {
+public:
+    LatencyHistogram(std::vector<double> latencies, const std::string& name);
+
+    double percentile(double p) const;
+    double average() const {
+        return _avg;
+    }
+    size_t count() const {
+        return _sorted.size();
+    }
+
+    void write_to_slog() const;
+    StatisticsReport::Parameters to_statistics(const std::string& json_prefix) const;
+
+private:
+    std::string _name;
+    std::vector<double> _sorted;
+    double _avg = 0.0;
+};
+
+/// @brief Results of an open-loop run
+struct OpenLoopResult {
+    size_t iterations = 0;
+    double duration_ms = 0.0;   // from the first arrival till the last completion
+    double offered_rate = 0.0;  // requests per second the schedule asked for
+    double achieved_rate = 0.0;
+    std::vector<double> execution;  // start till completion
+    std::vector<double> queueing;   // arrival till start
+    std::vector<double> total;      // arrival till completion
+};
+
+/// @brief Callback preparing the request for the given iteration (e.g. setting input tensors)
+using PrepareRequestFunction = std::function<void(InferReqWrap::Ptr&, size_t iteration)>;
+
+/**
+ * @brief Issues the requests at their arrival times regardless of the completions. When no request is idle at the
+ * arrival time the request waits for one, and the waiting time is reported as queueing delay, so overload shows up
+ * in the latency instead of silently reducing the offered rate.
+ * The run stops when niter requests are issued, the duration expires or the schedule is exhausted.
+ */
+OpenLoopResult run_open_loop(InferRequestsQueue& queue,
+                             ArrivalSchedule& schedule,
+                             uint64_t niter,
+                             uint64_t duration_ns,
+                             const PrepareRequestFunction& prepare);
+
+/**
+ * @brief Searches for the maximum request rate whose 99th percentile of the end-to-end latency fits the SLO.
+ * Each probe is an open-loop run with the given mode (CONSTANT or POISSON) for probe_duration_ns. A probe also fails
+ * when the achieved rate falls behind the offered one, i.e. the queue grows without bound.
+ * @param max_rate upper bound of the search, 0 means estimate it from a closed-loop probe
+ * @return the maximum sustainable rate in requests per second, 0 if even the lowest probed rate violates the SLO
+ */
+double find_max_rate_under_slo(InferRequestsQueue& queue,
+                               LoadMode mode,
+                               double slo_p99_ms,
+                               double max_rate,
+                               uint64_t probe_duration_ns,
+                               const PrepareRequestFunction& prepare);
+
+}  // namespace benchmark_app
@@ -34,6 +34,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -91,6 +92,18 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         throw std::logic_error(pcsort_err);
     }
 
+    const auto loadMode = benchmark_app::parse_load_mode(FLAGS_load_mode);
+    if (loadMode != benchmark_app::LoadMode::CLOSED && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop load modes require -api async.");
+    }
+    if (loadMode == benchmark_app::LoadMode::TRACE && FLAGS_trace.empty()) {
+        throw std::logic_error("The `trace` load mode requires the arrival times file. Please set -trace option.");
+    }
+    if (FLAGS_slo_p99 > 0 && loadMode != benchmark_app::LoadMode::CONSTANT &&
+        loadMode != benchmark_app::LoadMode::POISSON) {
+        throw std::logic_error("-slo_p99 option requires `constant` or `poisson` load mode.");
+    }
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -1109,21 +1122,7 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.reset_times();
 
-        size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
-            }
-
+        auto prepareRequest = [&](InferReqWrap::Ptr& inferRequest, size_t iteration) {
             if (!inferenceOnly) {
                 auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
@@ -1149,20 +1148,73 @@ int main(int argc, char* argv[]) {
                     }
                 }
             }
+        };
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                inferRequest->start_async();
+        const auto loadMode = benchmark_app::parse_load_mode(FLAGS_load_mode);
+        size_t processedFramesN = 0;
+        benchmark_app::OpenLoopResult openLoopResult;
+        double maxRateUnderSLO = 0.0;
+
+        if (loadMode == benchmark_app::LoadMode::CLOSED) {
+            auto startTime = Time::now();
+            auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
+                }
+
+                prepareRequest(inferRequest, iteration);
+
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    inferRequest->start_async();
+                }
+                ++iteration;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
             }
-            ++iteration;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
-        }
+            // wait the latest inference executions
+            inferRequestsQueue.wait_all();
+        } else {
+            // with the latency SLO set, -rate only bounds the search and the measured run uses the found rate
+            double rate = FLAGS_rate;
+            if (FLAGS_slo_p99 > 0) {
+                const uint64_t probeDuration =
+                    FLAGS_t != 0 ? get_duration_in_nanoseconds(FLAGS_t) : get_duration_in_nanoseconds(3);
+                maxRateUnderSLO = benchmark_app::find_max_rate_under_slo(inferRequestsQueue,
+                                                                         loadMode,
+                                                                         FLAGS_slo_p99,
+                                                                         FLAGS_rate,
+                                                                         probeDuration,
+                                                                         prepareRequest);
+                if (maxRateUnderSLO <= 0) {
+                    throw std::logic_error("No request rate meets the P99 latency SLO of " +
+                                           double_to_string(FLAGS_slo_p99) + " ms.");
+                }
+                slog::info << "Maximum rate under the P99 latency SLO: " << double_to_string(maxRateUnderSLO)
+                           << " requests/s" << slog::endl;
+                rate = maxRateUnderSLO;
+            }
 
-        // wait the latest inference executions
-        inferRequestsQueue.wait_all();
+            benchmark_app::ArrivalSchedule schedule(loadMode, rate, FLAGS_trace);
+            slog::info << "Open-loop " << benchmark_app::load_mode_to_string(loadMode) << " load, offered rate "
+                       << double_to_string(schedule.get_rate()) << " requests/s" << slog::endl;
+
+            openLoopResult =
+                benchmark_app::run_open_loop(inferRequestsQueue, schedule, niter, duration_nanoseconds, prepareRequest);
+            iteration = openLoopResult.iterations;
+            processedFramesN = iteration * batchSize;
+        }
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
@@ -1215,6 +1267,31 @@ int main(int argc, char* argv[]) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
         }
+
+        // open-loop latency distributions of the measured run
+        std::vector<benchmark_app::LatencyHistogram> openLoopHistograms;
+        if (loadMode != benchmark_app::LoadMode::CLOSED) {
+            openLoopHistograms.emplace_back(openLoopResult.total, "End-to-end latency");
+            openLoopHistograms.emplace_back(openLoopResult.queueing, "Queueing delay");
+            openLoopHistograms.emplace_back(openLoopResult.execution, "Execution time");
+
+            if (statistics) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("offered rate (requests/s)", "offered_rate", openLoopResult.offered_rate),
+                     StatisticsVariant("achieved rate (requests/s)", "achieved_rate", openLoopResult.achieved_rate)});
+                const std::vector<std::string> prefixes = {"latency_total", "queueing_delay", "execution_time"};
+                for (size_t i = 0; i < openLoopHistograms.size(); ++i) {
+                    statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                               openLoopHistograms[i].to_statistics(prefixes[i]));
+                }
+                if (FLAGS_slo_p99 > 0) {
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant("max rate under P99 SLO (requests/s)", "max_rate_under_slo", maxRateUnderSLO)});
+                }
+            }
+        }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
         next_step();
@@ -1292,6 +1369,20 @@ int main(int argc, char* argv[]) {
 
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
+        if (loadMode != benchmark_app::LoadMode::CLOSED) {
+            slog::info << "Offered rate:        " << double_to_string(openLoopResult.offered_rate) << " requests/s"
+                       << slog::endl;
+            slog::info << "Achieved rate:       " << double_to_string(openLoopResult.achieved_rate) << " requests/s"
+                       << slog::endl;
+        }
+        for (const auto& histogram : openLoopHistograms) {
+            histogram.write_to_slog();
+        }
+        if (FLAGS_slo_p99 > 0) {
+            slog::info << "Max rate with P99 latency under " << double_to_string(FLAGS_slo_p99)
+                       << " ms: " << double_to_string(maxRateUnderSLO) << " requests/s" << slog::endl;
+        }
+
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
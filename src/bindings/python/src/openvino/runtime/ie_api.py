@@ -122,7 +122,8 @@ class InferRequest(_InferRequestWrapper):
 
                               If set to `True` the data will be returned in form of views of output Tensors.
                               This mode still returns the data in format of numpy arrays but lifetime of the data
-                              is connected to OpenVINO objects.
+                              is connected to OpenVINO objects. Following inferences do not overwrite
+                              outputs still referenced by such arrays, see `InferRequest.double_buffered_outputs`.
 
                               Note: Use with extra care, shared data can be modified or lost during runtime!
 
@@ -360,7 +361,8 @@ class CompiledModel(CompiledModelBase):
 
                               If set to `True` the data will be returned in form of views of output Tensors.
                               This mode still returns the data in format of numpy arrays but lifetime of the data
-                              is connected to OpenVINO objects.
+                              is connected to OpenVINO objects. Following inferences do not overwrite
+                              outputs still referenced by such arrays, see `InferRequest.double_buffered_outputs`.
 
                               Note: Use with extra care, shared data can be modified or lost during runtime!
 
@@ -7,11 +7,14 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -19,6 +22,55 @@
 
 namespace py = pybind11;
 
+// Lock-free multi-producer single-consumer ring of completed request handles.
+// A handle is pushed once per inference and is not started again before the consumer pops it,
+// so a ring with at least as many slots as requests never overflows.
+class CompletionRing {
+public:
+    explicit CompletionRing(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_slots.reset(new std::atomic<int64_t>[size]);
+        for (size_t i = 0; i < size; i++) {
+            m_slots[i] = empty_slot;
+        }
+        m_mask = size - 1;
+    }
+
+    // Called from the inference threads
+    void push(size_t handle) {
+        const size_t pos = m_tail.fetch_add(1);
+        m_slots[pos & m_mask] = static_cast<int64_t>(handle);
+    }
+
+    // Called from the consumer thread only
+    bool pop(size_t& handle) {
+        auto& slot = m_slots[m_head & m_mask];
+        const int64_t value = slot;
+        if (value == empty_slot) {
+            return false;
+        }
+        slot = empty_slot;
+        m_head++;
+        handle = static_cast<size_t>(value);
+        return true;
+    }
+
+    // Called from the consumer thread only
+    bool empty() const {
+        return m_slots[m_head & m_mask] == empty_slot;
+    }
+
+private:
+    static constexpr int64_t empty_slot = -1;
+    std::unique_ptr<std::atomic<int64_t>[]> m_slots;
+    size_t m_mask = 0;
+    std::atomic<size_t> m_tail{0};
+    size_t m_head = 0;
+};
+
 class AsyncInferQueue {
 public:
     AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
@@ -36,11 +88,14 @@ public:
             m_user_ids.push_back(py::none());
             m_idle_handles.push(handle);
         }
+        m_completions.reset(new CompletionRing(jobs));
+        m_exceptions.resize(jobs);
 
         this->set_default_callbacks();
     }
 
     ~AsyncInferQueue() {
+        stop_dispatcher();
         m_requests.clear();
     }
 
@@ -79,7 +134,11 @@ public:
             request.m_request.wait();
         }
         // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // in batched mode completed requests may still wait for the delivery of their callbacks
+        m_cv.wait(lock, [this] {
+            return m_undelivered == 0;
+        });
         if (m_errors.size() > 0)
             throw m_errors.front();
     }
@@ -111,6 +170,7 @@ public:
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        stop_dispatcher();
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
@@ -151,6 +211,148 @@ public:
         }
     }
 
+    void set_batched_callbacks(py::function f_callback, size_t max_batch_size, double max_delay_ms) {
+        if (max_batch_size == 0) {
+            throw py::value_error("max_batch_size should be greater than 0.");
+        }
+        if (max_delay_ms < 0) {
+            throw py::value_error("max_delay_ms should not be negative.");
+        }
+        stop_dispatcher();
+        m_batched_callback = f_callback;
+        m_max_batch_size = max_batch_size;
+        m_max_delay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double, std::milli>(max_delay_ms));
+
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                // Only publish the completion, the dispatcher runs the Python callback and releases the handle
+                m_exceptions[handle] = exception_ptr;
+                m_undelivered++;
+                m_completions->push(handle);
+                if (m_dispatcher_waiting) {
+                    std::lock_guard<std::mutex> lock(m_dispatch_mutex);
+                    m_dispatch_cv.notify_one();
+                }
+
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+
+        m_stop_dispatcher = false;
+        m_dispatcher = std::thread(&AsyncInferQueue::dispatch_completions, this);
+    }
+
+    // Waits for the in-flight requests, delivers their callbacks and stops the dispatcher thread
+    void stop_dispatcher() {
+        if (!m_dispatcher.joinable()) {
+            return;
+        }
+        {
+            // release GIL, the dispatcher needs it to deliver pending callbacks
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                try {
+                    request.m_request.wait();
+                } catch (...) {
+                    // inference errors are reported by wait_all and get_idle_request_id
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_dispatch_mutex);
+                m_stop_dispatcher = true;
+            }
+            m_dispatch_cv.notify_one();
+            m_dispatcher.join();
+        }
+        m_batched_callback = py::function();
+    }
+
+    // Dispatcher thread: collects completions into batches of up to m_max_batch_size, waiting at most
+    // m_max_delay after the first one, and runs their Python callbacks under a single GIL acquisition
+    void dispatch_completions() {
+        std::vector<size_t> batch;
+        batch.reserve(m_max_batch_size);
+        const auto ready = [this] {
+            return m_stop_dispatcher || !m_completions->empty();
+        };
+        const auto drain = [this, &batch] {
+            size_t handle;
+            while (batch.size() < m_max_batch_size && m_completions->pop(handle)) {
+                batch.push_back(handle);
+            }
+        };
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_dispatch_mutex);
+                m_dispatcher_waiting = true;
+                m_dispatch_cv.wait(lock, ready);
+                m_dispatcher_waiting = false;
+            }
+            drain();
+            if (batch.empty()) {
+                if (m_stop_dispatcher) {
+                    break;
+                }
+                continue;
+            }
+
+            const auto deadline = std::chrono::steady_clock::now() + m_max_delay;
+            while (batch.size() < m_max_batch_size && !m_stop_dispatcher) {
+                std::unique_lock<std::mutex> lock(m_dispatch_mutex);
+                m_dispatcher_waiting = true;
+                const bool has_completions = m_dispatch_cv.wait_until(lock, deadline, ready);
+                m_dispatcher_waiting = false;
+                lock.unlock();
+                if (!has_completions) {
+                    break;
+                }
+                drain();
+            }
+
+            deliver_batch(batch);
+            batch.clear();
+        }
+    }
+
+    void deliver_batch(const std::vector<size_t>& batch) {
+        {
+            // Acquire GIL once for the whole batch, execute Python function
+            py::gil_scoped_acquire acquire;
+            for (auto handle : batch) {
+                if (m_exceptions[handle]) {
+                    continue;
+                }
+                try {
+                    m_batched_callback(m_requests[handle], m_user_ids[handle]);
+                } catch (const py::error_already_set& py_error) {
+                    assert(py_error.type());
+                    // acquire the mutex to access m_errors
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_errors.push(py_error);
+                }
+            }
+        }
+        {
+            // acquire the mutex to access m_idle_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto handle : batch) {
+                m_idle_handles.push(handle);
+            }
+            m_undelivered -= batch.size();
+        }
+        // Notify locks in getIdleRequestId() and wait_all()
+        m_cv.notify_all();
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -159,6 +361,19 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+
+    // Batched completion delivery, see set_batched_callbacks
+    std::unique_ptr<CompletionRing> m_completions;
+    std::vector<std::exception_ptr> m_exceptions;
+    std::atomic<size_t> m_undelivered{0};
+    py::function m_batched_callback;
+    size_t m_max_batch_size = 1;
+    std::chrono::steady_clock::duration m_max_delay{0};
+    std::thread m_dispatcher;
+    std::mutex m_dispatch_mutex;
+    std::condition_variable m_dispatch_cv;
+    std::atomic<bool> m_dispatcher_waiting{false};
+    std::atomic<bool> m_stop_dispatcher{false};
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -318,6 +533,40 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batched_callback",
+            &AsyncInferQueue::set_batched_callbacks,
+            py::arg("callback"),
+            py::arg("max_batch_size") = 32,
+            py::arg("max_delay_ms") = 1.0,
+            R"(
+            Sets unified callback on all InferRequests from queue's pool and delivers
+            completions in batches.
+
+            Completed requests are collected by a background thread that acquires the GIL
+            once per batch and calls the callback for every request of the batch. A batch is
+            delivered when it holds `max_batch_size` requests or `max_delay_ms` milliseconds
+            after its first request has completed. Requests are returned to the pool only
+            after their callback has been called.
+
+            Signature of the callback is the same as for `set_callback`. The callback must not
+            wait for requests of the same queue, e.g. by calling `start_async` or `wait_all`.
+            Calling `set_callback` switches the queue back to per-request callbacks.
+
+            .. code-block:: python
+
+                def f(request, userdata):
+                    results[userdata] = request.output_tensors[0].data.copy()
+
+                async_infer_queue.set_batched_callback(f, max_batch_size=64, max_delay_ms=0.5)
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+            :param max_batch_size: Maximum number of completions delivered under one GIL acquisition.
+            :type max_batch_size: int
+            :param max_delay_ms: Maximum time to wait for more completions after the first one.
+            :type max_delay_ms: float
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
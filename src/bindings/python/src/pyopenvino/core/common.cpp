@@ -137,10 +137,7 @@ py::array array_from_tensor(ov::Tensor&& t, bool is_shared) {
 
     // Return the array as a view:
     if (is_shared) {
-        if (ov_type.bitwidth() < Common::values::min_bitwidth) {
-            return py::array(dtype, t.get_byte_size(), t.data(), py::cast(t));
-        }
-        return py::array(dtype, t.get_shape(), t.get_strides(), t.data(), py::cast(t));
+        return array_from_tensor(std::move(t), py::cast(t));
     }
     // Return the array as a copy:
     if (ov_type.bitwidth() < Common::values::min_bitwidth) {
@@ -149,6 +146,17 @@ py::array array_from_tensor(ov::Tensor&& t, bool is_shared) {
     return py::array(dtype, t.get_shape(), t.get_strides(), t.data());
 }
 
+py::array array_from_tensor(ov::Tensor&& t, const py::object& base) {
+    auto ov_type = t.get_element_type();
+    auto dtype = Common::ov_type_to_dtype().at(ov_type);
+
+    // Return the array as a view, base keeps the memory alive:
+    if (ov_type.bitwidth() < Common::values::min_bitwidth) {
+        return py::array(dtype, t.get_byte_size(), t.data(), base);
+    }
+    return py::array(dtype, t.get_shape(), t.get_strides(), t.data(), base);
+}
+
 };  // namespace array_helpers
 
 template <>
@@ -330,14 +338,77 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
+namespace {
+// Returns a view of the output, registering the output tensor as one of the output buffers
+py::array shared_output_view(InferRequestWrapper& request, size_t idx) {
+    auto& shared = *request.m_shared_outputs;
+    if (shared.buffers.empty()) {
+        shared.buffers.resize(request.m_outputs.size());
+        shared.current.assign(request.m_outputs.size(), 0);
+    }
+    auto tensor = request.m_request.get_tensor(request.m_outputs[idx]);
+    auto& buffers = shared.buffers[idx];
+    auto& current = shared.current[idx];
+    if (buffers.empty()) {
+        buffers.push_back(py::cast(tensor));
+        current = 0;
+    } else {
+        // the plugin may reallocate outputs of dynamic shapes
+        const auto& held = buffers[current].cast<const ov::Tensor&>();
+        if (held.data() != tensor.data() || held.get_shape() != tensor.get_shape()) {
+            buffers[current] = py::cast(tensor);
+        }
+    }
+    return array_helpers::array_from_tensor(std::move(tensor), buffers[current]);
+}
+}  // namespace
+
 py::dict outputs_to_dict(InferRequestWrapper& request, bool share_outputs) {
     py::dict res;
-    for (const auto& out : request.m_outputs) {
-        res[py::cast(out)] = array_helpers::array_from_tensor(request.m_request.get_tensor(out), share_outputs);
+    for (size_t i = 0; i < request.m_outputs.size(); i++) {
+        const auto& out = request.m_outputs[i];
+        if (share_outputs) {
+            res[py::cast(out)] = shared_output_view(request, i);
+        } else {
+            res[py::cast(out)] = array_helpers::array_from_tensor(request.m_request.get_tensor(out), false);
+        }
     }
     return res;
 }
 
+void protect_shared_outputs(InferRequestWrapper& request) {
+    // Must be called with GIL held, before the request starts
+    auto& shared = *request.m_shared_outputs;
+    for (size_t i = 0; i < shared.buffers.size(); i++) {
+        auto& buffers = shared.buffers[i];
+        if (buffers.empty() || buffers[shared.current[i]].ref_count() == 1) {
+            // no view references the current buffer, it can be overwritten
+            continue;
+        }
+        size_t next = buffers.size();
+        for (size_t j = 0; j < buffers.size(); j++) {
+            if (buffers[j].ref_count() == 1) {
+                next = j;
+                break;
+            }
+        }
+        if (next == buffers.size()) {
+            // all buffers are in use, allocate a new one; a pinned buffer dropped from the list
+            // lives as long as its views
+            const auto& pinned = buffers[shared.current[i]].cast<const ov::Tensor&>();
+            auto buffer = py::cast(ov::Tensor(pinned.get_element_type(), pinned.get_shape()));
+            if (buffers.size() < shared.max_buffers) {
+                buffers.push_back(buffer);
+            } else {
+                next = shared.current[i];
+                buffers[next] = buffer;
+            }
+        }
+        shared.current[i] = next;
+        request.m_request.set_tensor(request.m_outputs[i], buffers[next].cast<ov::Tensor&>());
+    }
+}
+
 ov::pass::Serialize::Version convert_to_version(const std::string& version) {
     using Version = ov::pass::Serialize::Version;
 
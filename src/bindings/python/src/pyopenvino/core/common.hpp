@@ -60,6 +60,8 @@ py::array as_contiguous(py::array& array, ov::element::Type type);
 
 py::array array_from_tensor(ov::Tensor&& t, bool is_shared);
 
+py::array array_from_tensor(ov::Tensor&& t, const py::object& base);
+
 }; // namespace array_helpers
 
 template <typename T>
@@ -96,6 +98,8 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual);
 
 py::dict outputs_to_dict(InferRequestWrapper& request, bool share_outputs);
 
+void protect_shared_outputs(InferRequestWrapper& request);
+
 ov::pass::Serialize::Version convert_to_version(const std::string& version);
 
 template <typename T>
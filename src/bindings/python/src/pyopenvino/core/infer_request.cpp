@@ -16,6 +16,7 @@
 namespace py = pybind11;
 
 inline py::object run_sync_infer(InferRequestWrapper& self, bool share_outputs) {
+    Common::protect_shared_outputs(self);
     {
         py::gil_scoped_release release;
         *self.m_start_time = Time::now();
@@ -229,6 +230,7 @@ void regclass_InferRequest(py::module m) {
                     PyErr_WarnEx(PyExc_RuntimeWarning, "There is no callback function to pass `userdata` into!", 1);
                 }
             }
+            Common::protect_shared_outputs(self);
             py::gil_scoped_release release;
             *self.m_start_time = Time::now();
             self.m_request.start_async();
@@ -268,6 +270,7 @@ void regclass_InferRequest(py::module m) {
                     PyErr_WarnEx(PyExc_RuntimeWarning, "There is no callback function!", 1);
                 }
             }
+            Common::protect_shared_outputs(self);
             py::gil_scoped_release release;
             *self.m_start_time = Time::now();
             self.m_request.start_async();
@@ -726,6 +729,29 @@ void regclass_InferRequest(py::module m) {
             :rtype: List[openvino.runtime.ProfilingInfo]
         )");
 
+    cls.def_property(
+        "double_buffered_outputs",
+        [](InferRequestWrapper& self) {
+            return self.m_shared_outputs->max_buffers > 1;
+        },
+        [](InferRequestWrapper& self, bool enable) {
+            self.m_shared_outputs->max_buffers = enable ? 2 : 1;
+        },
+        R"(
+            Controls the number of output buffers kept for `share_outputs` mode.
+
+            Arrays returned with `share_outputs=True` are views of output buffers and keep
+            them alive. Before the next inference an output buffer still referenced from Python
+            is replaced, so the inference never overwrites data visible to Python.
+            With a single buffer a new one is allocated in that case. With double-buffered
+            outputs the request alternates between two buffers per output and allocates only
+            if both of them are still referenced.
+
+            Default value: False
+
+            :rtype: bool
+        )");
+
     cls.def_property_readonly(
         "results",
         [](InferRequestWrapper& self) {
@@ -7,7 +7,9 @@
 #include <pybind11/pybind11.h>
 
 #include <chrono>
+#include <memory>
 #include <openvino/runtime/infer_request.hpp>
+#include <vector>
 
 #include "openvino/core/except.hpp"
 
@@ -16,6 +18,18 @@ namespace py = pybind11;
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
+// Output buffers behind the views returned in share_outputs mode.
+// Views keep their buffer alive, so a buffer still referenced from Python is swapped for a free one
+// before the next inference instead of being overwritten, see Common::protect_shared_outputs.
+struct SharedOutputBuffers {
+    // Python Tensor objects per output, only referenced from here when no view uses them
+    std::vector<std::vector<py::object>> buffers;
+    // Buffer the request writes to, per output
+    std::vector<size_t> current;
+    // Number of buffers kept per output, 2 makes the outputs double-buffered
+    size_t max_buffers = 1;
+};
+
 class InferRequestWrapper {
 public:
     // InferRequestWrapper is getting original ov::InferRequest as rvalue.
@@ -38,6 +52,7 @@ public:
           m_userdata{userdata} {
         m_start_time = std::make_shared<Time::time_point>(Time::time_point{});
         m_end_time = std::make_shared<Time::time_point>(Time::time_point{});
+        m_shared_outputs = std::make_shared<SharedOutputBuffers>();
 
         // Initialize InferRequest with default callback
         if (set_default_callback) {
@@ -84,6 +99,8 @@ public:
     // Times of inference's start and finish
     std::shared_ptr<Time::time_point> m_start_time;  // proposal: change to unique_ptr
     std::shared_ptr<Time::time_point> m_end_time;
+    // Output buffers of share_outputs mode, shared between copies of the wrapper
+    std::shared_ptr<SharedOutputBuffers> m_shared_outputs;
 
 private:
     inline std::vector<ov::Tensor> get_tensors_from(const std::vector<ov::Output<const ov::Node>>& v) {
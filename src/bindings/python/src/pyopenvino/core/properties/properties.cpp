@@ -91,6 +91,14 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_intel_cpu,
                      ov::intel_cpu::sparse_weights_decompression_rate,
                      "sparse_weights_decompression_rate");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::share_weights_across_models, "share_weights_across_models");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::streams_auto_tune, "streams_auto_tune");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::elastic_streams, "elastic_streams");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::dynamic_quantization, "dynamic_quantization");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::kernel_cache_dir, "kernel_cache_dir");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::kernel_cache_size, "kernel_cache_size");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::layout_optimization, "layout_optimization");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::shared_weights_memory_size, "shared_weights_memory_size");
 
     // Submodule intel_gpu
     py::module m_intel_gpu =
@@ -507,6 +507,60 @@ def test_infer_queue(device, share_inputs):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+@pytest.mark.parametrize(("max_batch_size", "max_delay_ms"), [(1, 0.0), (4, 1.0), (64, 50.0)])
+def test_infer_queue_batched_callback(device, max_batch_size, max_delay_ms):
+    jobs = 32
+    num_request = 4
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        results[job_id] = request.get_output_tensor().data.copy()
+
+    infer_queue.set_batched_callback(callback, max_batch_size=max_batch_size, max_delay_ms=max_delay_ms)
+    for i in range(jobs):
+        infer_queue.start_async({0: np.full([10], i - jobs // 2, dtype=np.float32)}, i)
+    infer_queue.wait_all()
+
+    for i, result in enumerate(results):
+        assert np.array_equal(result, np.full([10], max(i - jobs // 2, 0), dtype=np.float32))
+
+    # Switching back to per-request callbacks
+    finished = []
+    infer_queue.set_callback(lambda request, job_id: finished.append(job_id))
+    for i in range(num_request):
+        infer_queue.start_async({0: np.zeros([10], dtype=np.float32)}, i)
+    infer_queue.wait_all()
+    assert sorted(finished) == list(range(num_request))
+
+
+def test_infer_queue_batched_callback_fail(device):
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+
+    def callback(request, userdata):
+        return userdata + 1
+
+    infer_queue.set_batched_callback(callback)
+    with pytest.raises(TypeError) as e:
+        for _ in range(4):
+            infer_queue.start_async({0: np.zeros([10], dtype=np.float32)}, "userdata")
+        infer_queue.wait_all()
+
+    assert "can only concatenate str" in str(e.value)
+
+    with pytest.raises(ValueError) as e:
+        infer_queue.set_batched_callback(callback, max_batch_size=0)
+    assert "max_batch_size should be greater than 0" in str(e.value)
+
+
 def test_infer_queue_iteration(device):
     core = Core()
     param = ops.parameter([10])
@@ -1247,3 +1301,31 @@ def test_infer_request_share_memory(device, share_inputs, share_outputs, is_posi
     else:
         assert not out_tensor_shares
         assert results[0].flags["OWNDATA"] is True
+
+
+@pytest.mark.parametrize("double_buffered", [True, False])
+def test_infer_request_share_outputs_pinned(device, double_buffered):
+    _, request, _, input_data = abs_model_with_data(device, Type.f32, np.float32)
+    request.double_buffered_outputs = double_buffered
+    assert request.double_buffered_outputs is double_buffered
+
+    first = request.infer(input_data, share_outputs=True)[0]
+    # Output still referenced from Python is not overwritten by the next inference
+    second = request.infer(-input_data * 2, share_outputs=True)[0]
+    assert np.array_equal(first, np.abs(input_data))
+    assert np.array_equal(second, np.abs(input_data * 2))
+    assert not np.shares_memory(first, second)
+    assert np.shares_memory(request.get_output_tensor(0).data, second)
+
+    # Released buffers are reused
+    del first
+    third = request.infer(input_data * 3, share_outputs=True)[0]
+    assert np.array_equal(third, np.abs(input_data * 3))
+    assert np.array_equal(second, np.abs(input_data * 2))
+
+    del second
+    del third
+    buffer = request.infer(input_data, share_outputs=True)[0]
+    del buffer
+    reused = request.infer(input_data, share_outputs=True)[0]
+    assert np.shares_memory(request.get_output_tensor(0).data, reused)
@@ -161,6 +161,7 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (properties.device.uuid, "DEVICE_UUID"),
         (properties.device.luid, "DEVICE_LUID"),
         (properties.device.capabilities, "OPTIMIZATION_CAPABILITIES"),
+        (properties.intel_cpu.shared_weights_memory_size, "CPU_SHARED_WEIGHTS_MEMORY_SIZE"),
         (properties.intel_gpu.device_total_mem_size, "GPU_DEVICE_TOTAL_MEM_SIZE"),
         (properties.intel_gpu.uarch_version, "GPU_UARCH_VERSION"),
         (properties.intel_gpu.execution_units_count, "GPU_EXECUTION_UNITS_COUNT"),
@@ -279,6 +280,41 @@ def test_properties_ro(ov_property_ro, expected_value):
             "CPU_DENORMALS_OPTIMIZATION",
             ((True, True),),
         ),
+        (
+            properties.intel_cpu.share_weights_across_models,
+            "CPU_SHARE_WEIGHTS_ACROSS_MODELS",
+            ((True, True),),
+        ),
+        (
+            properties.intel_cpu.streams_auto_tune,
+            "CPU_STREAMS_AUTO_TUNE",
+            ((True, True),),
+        ),
+        (
+            properties.intel_cpu.elastic_streams,
+            "CPU_ELASTIC_STREAMS",
+            ((True, True),),
+        ),
+        (
+            properties.intel_cpu.dynamic_quantization,
+            "CPU_DYNAMIC_QUANTIZATION",
+            ((True, True),),
+        ),
+        (
+            properties.intel_cpu.kernel_cache_dir,
+            "CPU_KERNEL_CACHE_DIR",
+            (("./test_kernels", "./test_kernels"),),
+        ),
+        (
+            properties.intel_cpu.kernel_cache_size,
+            "CPU_KERNEL_CACHE_SIZE",
+            ((1024, 1024),),
+        ),
+        (
+            properties.intel_cpu.layout_optimization,
+            "CPU_LAYOUT_OPTIMIZATION",
+            ((True, True),),
+        ),
         (
             properties.intel_cpu.sparse_weights_decompression_rate,
             "CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE",
@@ -78,10 +78,14 @@ public:
 
     /**
      * @brief Copy tensor, destination tensor should have the same element type and shape
+     * Element types may differ for f32, f16 and bf16 tensors, the conversion is done during the copy.
      *
      * @param dst destination tensor
+     * @param non_temporal write large destinations with non-temporal stores, which bypass the cache. Use it only
+     * for destinations that are not read soon after the copy (e.g. outputs handed over to the user), otherwise
+     * the consumer reads them back from memory.
      */
-    void copy_to(const std::shared_ptr<ov::ITensor>& dst) const;
+    void copy_to(const std::shared_ptr<ov::ITensor>& dst, bool non_temporal = false) const;
 
 protected:
     virtual ~ITensor();
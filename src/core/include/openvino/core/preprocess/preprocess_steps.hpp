@@ -110,6 +110,10 @@ public:
 
     /// \brief Add resize operation to model's dimensions.
     ///
+    /// If the model height or width is dynamic, the target size is known at inference time only. Then the model gets
+    /// an additional input '<input name>/resize_size' of type i64 and shape {2} holding {height, width} of the
+    /// resized image. The models with static height and width are not affected.
+    ///
     /// \param alg Resize algorithm.
     ///
     /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner.
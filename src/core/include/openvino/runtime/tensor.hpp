@@ -165,6 +165,7 @@ public:
 
     /**
      * @brief Copy tensor, destination tensor should have the same element type and shape
+     * Element types may differ for f32, f16 and bf16 tensors, the conversion is done during the copy.
      *
      * @param dst destination tensor
      */
@@ -162,6 +162,7 @@ bool InputInfo::InputInfoImpl::build(const std::shared_ptr<Model>& model,
     context.target_layout() = data.m_model_layout;
     context.model_shape() = data.m_param->get_partial_shape();
     context.target_element_type() = data.m_param->get_element_type();
+    context.model_param() = data.m_param;
 
     // Apply preprocessing
     auto nodes = data.as_nodes();
@@ -220,6 +221,7 @@ bool InputInfo::InputInfoImpl::build(const std::shared_ptr<Model>& model,
         // Insert list of new parameters to the place of original parameter
         param_it = parameters_list.erase(param_it);
         parameters_list.insert(param_it, data.m_new_params.begin(), data.m_new_params.end());
+        parameters_list.insert(param_it, context.extra_params().begin(), context.extra_params().end());
     }
     return need_validate;
 }
@@ -235,6 +237,7 @@ void InputInfo::InputInfoImpl::dump(std::ostream& str,
     context.target_layout() = data.m_model_layout;
     context.model_shape() = data.m_param->get_partial_shape();
     context.target_element_type() = data.m_param->get_element_type();
+    context.model_param() = data.m_param;
     bool need_dump = nodes.size() > 1 || nodes[0].get_partial_shape() != context.model_shape() ||
                      data.m_param->get_layout() != context.target_layout() ||
                      nodes[0].get_element_type() != context.target_element_type() ||
@@ -203,12 +203,29 @@ void PreStepsList::add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_
                 OPENVINO_ASSERT(ctxt.model_shape().rank().is_static(),
                                 "Resize is not fully specified while target model shape is dynamic");
             }
-            const int new_image_width = dst_width < 0 ? static_cast<int>(ctxt.get_model_width_for_resize()) : dst_width;
-            const int new_image_height =
-                dst_height < 0 ? static_cast<int>(ctxt.get_model_height_for_resize()) : dst_height;
-
-            const auto target_spatial_shape =
-                op::v0::Constant::create<int64_t>(element::i64, Shape{2}, {new_image_height, new_image_width});
+            Output<Node> target_spatial_shape;
+            if ((dst_height < 0 || dst_width < 0) && !ctxt.has_static_model_spatial_dims()) {
+                // Model height/width are known at inference time only, so target size becomes an additional
+                // model input '<input name>/resize_size' of type i64 and shape {2} holding {height, width}
+                OPENVINO_ASSERT(ctxt.model_param(), "Internal error: Resize to dynamic model shape requires input");
+                const std::string sub_name = "/resize_size";
+                auto size_param = std::make_shared<op::v0::Parameter>(element::i64, Shape{2});
+                std::unordered_set<std::string> size_tensor_names;
+                for (const auto& tensor_name : ctxt.model_param()->get_default_output().get_names()) {
+                    size_tensor_names.insert(tensor_name + sub_name);
+                }
+                size_param->get_default_output().get_tensor().set_names(size_tensor_names);
+                size_param->set_friendly_name(ctxt.model_param()->get_friendly_name() + sub_name);
+                ctxt.extra_params().push_back(size_param);
+                target_spatial_shape = size_param;
+            } else {
+                const int new_image_width =
+                    dst_width < 0 ? static_cast<int>(ctxt.get_model_width_for_resize()) : dst_width;
+                const int new_image_height =
+                    dst_height < 0 ? static_cast<int>(ctxt.get_model_height_for_resize()) : dst_height;
+                target_spatial_shape =
+                    op::v0::Constant::create<int64_t>(element::i64, Shape{2}, {new_image_height, new_image_width});
+            }
             // In future consider replacing this to set of new OV operations like `getDimByName(node, "H")`
             // This is to allow specifying layout on 'evaluation' stage
             const auto axes = op::v0::Constant::create<int64_t>(element::i64, Shape{2}, {height_idx, width_idx});
@@ -12,6 +12,7 @@
 #include "openvino/core/preprocess/color_format.hpp"
 #include "openvino/core/preprocess/postprocess_steps.hpp"
 #include "openvino/core/preprocess/preprocess_steps.hpp"
+#include "openvino/op/parameter.hpp"
 #include "tensor_name_util.hpp"
 
 namespace ov {
@@ -112,6 +113,11 @@ public:
         return m_model_shape;
     }
 
+    bool has_static_model_spatial_dims() const {
+        return model_shape()[get_and_check_height_idx(target_layout(), model_shape())].is_static() &&
+               model_shape()[get_and_check_width_idx(target_layout(), model_shape())].is_static();
+    }
+
     size_t get_model_height_for_resize() const {
         auto model_height_idx = get_and_check_height_idx(target_layout(), model_shape());
         OPENVINO_ASSERT(model_shape()[model_height_idx].is_static(),
@@ -134,10 +140,30 @@ public:
         return m_color_format;
     }
 
+    // Original model parameter being preprocessed
+    const std::shared_ptr<op::v0::Parameter>& model_param() const {
+        return m_model_param;
+    }
+
+    std::shared_ptr<op::v0::Parameter>& model_param() {
+        return m_model_param;
+    }
+
+    // Additional model inputs created by preprocessing operations, e.g. target size of resize to dynamic model shape
+    const std::vector<std::shared_ptr<op::v0::Parameter>>& extra_params() const {
+        return m_extra_params;
+    }
+
+    std::vector<std::shared_ptr<op::v0::Parameter>>& extra_params() {
+        return m_extra_params;
+    }
+
 private:
     PartialShape m_model_shape;
     Layout m_model_layout;
     ColorFormat m_color_format = ColorFormat::UNDEFINED;
+    std::shared_ptr<op::v0::Parameter> m_model_param;
+    std::vector<std::shared_ptr<op::v0::Parameter>> m_extra_params;
 };
 
 using InternalPreprocessOp =
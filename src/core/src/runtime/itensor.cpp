@@ -4,15 +4,210 @@
 
 #include "openvino/runtime/itensor.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/core/visibility.hpp"
 #include "openvino/runtime/allocator.hpp"
 #include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
 
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <emmintrin.h>
+#endif
+
 namespace ov {
 
+namespace {
+
+// Copies larger than this are split between threads
+constexpr size_t parallel_copy_min_bytes = 256 * 1024;
+// Destinations larger than this are written with non-temporal stores when the caller asks for them: a copy of that
+// size evicts most of the cache anyway
+constexpr size_t stream_copy_min_bytes = 4 * 1024 * 1024;
+
+using ConvertRow = void (*)(uint8_t* dst, const uint8_t* src, size_t count);
+
+template <typename S, typename D>
+void convert_row(uint8_t* dst, const uint8_t* src, size_t count) {
+    const auto src_typed = reinterpret_cast<const S*>(src);
+    const auto dst_typed = reinterpret_cast<D*>(dst);
+    for (size_t i = 0; i < count; ++i)
+        dst_typed[i] = static_cast<D>(static_cast<float>(src_typed[i]));
+}
+
+// Conversions that can be fused into the copy, nullptr if the pair is not supported
+ConvertRow get_convert_row(const element::Type& src, const element::Type& dst) {
+    using namespace element;
+    if (src == f32 && dst == bf16)
+        return convert_row<float, ov::bfloat16>;
+    if (src == f32 && dst == f16)
+        return convert_row<float, ov::float16>;
+    if (src == bf16 && dst == f32)
+        return convert_row<ov::bfloat16, float>;
+    if (src == f16 && dst == f32)
+        return convert_row<ov::float16, float>;
+    if (src == bf16 && dst == f16)
+        return convert_row<ov::bfloat16, ov::float16>;
+    if (src == f16 && dst == bf16)
+        return convert_row<ov::float16, ov::bfloat16>;
+    return nullptr;
+}
+
+void stream_copy(uint8_t* dst, const uint8_t* src, size_t size) {
+#if defined(OPENVINO_ARCH_X86_64)
+    constexpr size_t vec = sizeof(__m128i);
+    const size_t head = (vec - reinterpret_cast<uintptr_t>(dst) % vec) % vec;
+    if (size < head + 4 * vec) {
+        memcpy(dst, src, size);
+        return;
+    }
+    memcpy(dst, src, head);
+    size_t i = head;
+    for (; i + 4 * vec <= size; i += 4 * vec) {
+        const auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + vec));
+        const auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 2 * vec));
+        const auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 3 * vec));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + vec), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 2 * vec), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 3 * vec), v3);
+    }
+    memcpy(dst + i, src + i, size - i);
+#else
+    memcpy(dst, src, size);
+#endif
+}
+
+void stream_fence() {
+#if defined(OPENVINO_ARCH_X86_64)
+    _mm_sfence();
+#endif
+}
+
+struct CopyDim {
+    size_t size;
+    size_t dst_stride;
+    size_t src_stride;
+};
+
+/**
+ * @brief Copies a strided tensor to another one, optionally converting elements.
+ * Dimensions of size 1 are dropped and dimensions that are dense in both tensors are collapsed, so the copy runs
+ * over the longest contiguous rows the layouts allow. Rows are split between threads for large tensors.
+ * Large copies without conversion use non-temporal stores if non_temporal is set. Strides are in bytes.
+ */
+void copy_strided(uint8_t* dst,
+                  const uint8_t* src,
+                  const ov::Shape& shape,
+                  const ov::Strides& dst_strides,
+                  const ov::Strides& src_strides,
+                  size_t dst_elem_size,
+                  size_t src_elem_size,
+                  ConvertRow convert,
+                  bool non_temporal) {
+    if (shape_size(shape) == 0)
+        return;
+
+    std::vector<CopyDim> dims;
+    dims.reserve(shape.size());
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] != 1)
+            dims.push_back({shape[i], dst_strides[i], src_strides[i]});
+    }
+    // innermost dimensions dense in both tensors form the row
+    size_t row = 1;
+    while (!dims.empty() && dims.back().src_stride == row * src_elem_size &&
+           dims.back().dst_stride == row * dst_elem_size) {
+        row *= dims.back().size;
+        dims.pop_back();
+    }
+    // outer dimensions nested densely are merged
+    std::vector<CopyDim> outer;
+    outer.reserve(dims.size());
+    for (auto it = dims.rbegin(); it != dims.rend(); ++it) {
+        if (!outer.empty()) {
+            auto& inner = outer.back();
+            if (it->src_stride == inner.src_stride * inner.size && it->dst_stride == inner.dst_stride * inner.size) {
+                inner.size *= it->size;
+                continue;
+            }
+        }
+        outer.push_back(*it);
+    }
+    std::reverse(outer.begin(), outer.end());
+
+    size_t rows = 1;
+    for (const auto& dim : outer)
+        rows *= dim.size;
+    const size_t total_bytes = rows * row * dst_elem_size;
+    const bool stream = non_temporal && !convert && total_bytes >= stream_copy_min_bytes;
+
+    const auto copy_row = [&](uint8_t* dst_row, const uint8_t* src_row, size_t count) {
+        if (convert)
+            convert(dst_row, src_row, count);
+        else if (stream)
+            stream_copy(dst_row, src_row, count * dst_elem_size);
+        else
+            memcpy(dst_row, src_row, count * dst_elem_size);
+    };
+
+    const int max_threads = static_cast<int>(std::min<size_t>(
+        parallel_get_max_threads(),
+        std::max<size_t>(1, total_bytes / parallel_copy_min_bytes)));
+
+    if (outer.empty()) {
+        // dense copy, the single row is split between threads
+        ov::parallel_nt(max_threads, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            ov::splitter(row, nthr, ithr, start, end);
+            if (start < end)
+                copy_row(dst + start * dst_elem_size, src + start * src_elem_size, end - start);
+            if (stream)
+                stream_fence();
+        });
+        return;
+    }
+
+    ov::parallel_nt(static_cast<int>(std::min<size_t>(max_threads, rows)), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        ov::splitter(rows, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<size_t> pos(outer.size());
+        size_t dst_offset = 0, src_offset = 0;
+        for (size_t i = outer.size(), idx = start; i-- > 0;) {
+            pos[i] = idx % outer[i].size;
+            idx /= outer[i].size;
+            dst_offset += pos[i] * outer[i].dst_stride;
+            src_offset += pos[i] * outer[i].src_stride;
+        }
+        for (size_t r = start; r < end; ++r) {
+            copy_row(dst + dst_offset, src + src_offset, row);
+            for (size_t i = outer.size(); i-- > 0;) {
+                dst_offset += outer[i].dst_stride;
+                src_offset += outer[i].src_stride;
+                if (++pos[i] < outer[i].size)
+                    break;
+                dst_offset -= outer[i].size * outer[i].dst_stride;
+                src_offset -= outer[i].size * outer[i].src_stride;
+                pos[i] = 0;
+            }
+        }
+        if (stream)
+            stream_fence();
+    });
+}
+
+}  // namespace
+
 ITensor::~ITensor() = default;
 
 size_t ITensor::get_size() const {
@@ -44,7 +239,7 @@ bool ITensor::is_continuous() const {
     return byte_strides == get_strides();
 }
 
-void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
+void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst, bool non_temporal) const {
     const auto& is_scalar = [](const ov::Shape& shape) {
         return shape.empty() || (shape.size() == 1 && shape[0] == 1);
     };
@@ -57,11 +252,16 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
                     "Default copy to doesn't support copy from remote tensor.");
     OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(dst),
                     "Default copy to doesn't support copy to remote tensor.");
-    OPENVINO_ASSERT(dst->get_element_type() == get_element_type(),
+    const auto& src_type = get_element_type();
+    const auto& dst_type = dst->get_element_type();
+    ConvertRow convert = nullptr;
+    if (dst_type != src_type)
+        convert = get_convert_row(src_type, dst_type);
+    OPENVINO_ASSERT(dst_type == src_type || convert,
                     "Tensor element types are not equal. (src: ",
-                    get_element_type(),
+                    src_type,
                     " != dst: ",
-                    dst->get_element_type(),
+                    dst_type,
                     ")");
     if (dst->get_shape() == ov::Shape{0})
         dst->set_shape(get_shape());
@@ -71,106 +271,35 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
                     " != dst: ",
                     dst->get_shape(),
                     ")");
-    const auto& shape = get_shape();
     auto* src_data = static_cast<const uint8_t*>(data());
     auto* dst_data = static_cast<uint8_t*>(dst->data());
-    ov::Strides src_strides{get_byte_size()};
-    ov::Strides dst_strides{dst->get_byte_size()};
-    ov::Shape cur_pos{0};
-    ov::Shape max_pos{1};
 
-    if (get_element_type().bitwidth() < 8 || (get_strides() == dst->get_strides() && is_continuous()) ||
-        (is_scalar(get_shape()) && is_scalar(dst->get_shape()))) {
+    if (src_type.bitwidth() < 8) {
         // OpenVINO doesn't support strides for LP types
-        // or both tensors have default strides
-        // Strides and positions already initialized
-    } else {
-        // Tensors have default strides
-        const auto& type = get_element_type();
-        std::vector<size_t> strides(shape.size());
-        if (!shape.empty()) {
-            strides[shape.size() - 1] = 1;
-        }
-        auto size = shape.size();
-        for (size_t i = 1; i < size; i++) {
-            strides[size - i - 1] = strides[size - i] * shape[size - i];
-        }
-
-        ov::Strides default_strides(strides.size());
-        for (size_t i = 0; i < strides.size(); ++i)
-            default_strides[i] = strides[i] * type.size();
-
-        src_strides = get_strides();
-        dst_strides = dst->get_strides();
-
-        ov::Strides src_str, dst_str;
-
-        // Calculate src and dst shapes
-        bool found_step = false;
-        for (size_t i = 0; i < shape.size(); i++) {
-            size_t inverted_idx = shape.size() - i - 1;
-            if (!found_step) {
-                if (default_strides[inverted_idx] == src_strides[inverted_idx] &&
-                    src_strides[inverted_idx] == dst_strides[inverted_idx]) {
-                    continue;
-                } else {
-                    found_step = true;
-                    size_t strides_size = inverted_idx + 1;
-                    // Set right size
-                    src_str.resize(strides_size + 1);
-                    dst_str.resize(strides_size + 1);
-                    max_pos.resize(strides_size + 1);
-                    cur_pos.resize(strides_size + 1);
-                    // In case of default continuous strides we can copy several elements
-                    // In other case only one element
-                    size_t dim = 1;
-                    size_t strides = type.size();
-
-                    if (strides_size < default_strides.size()) {
-                        strides = default_strides[strides_size];
-                        dim = get_shape()[strides_size];
-                    }
-                    src_str[strides_size] = strides;
-                    dst_str[strides_size] = strides;
-                    max_pos[strides_size] = dim;
-                    cur_pos[strides_size] = 0;
-                }
-            }
-            src_str[inverted_idx] = src_strides[inverted_idx];
-            dst_str[inverted_idx] = dst_strides[inverted_idx];
-            max_pos[inverted_idx] = shape[inverted_idx];
-            cur_pos[inverted_idx] = 0;
-        }
-        src_strides = src_str;
-        dst_strides = dst_str;
+        memcpy(dst_data, src_data, get_byte_size());
+        return;
     }
 
-    const auto update_index = [](const ov::Shape& pos, const ov::Shape& shape, const ov::Strides& strides) {
-        size_t offset = 0;
-
-        for (size_t i = 0; i < pos.size(); i++) {
-            offset += pos[i] * strides[i];
-        }
-        return offset;
-    };
-
-    bool finish = false;
-    for (size_t dst_idx = 0, src_idx = 0; !finish;) {
-        memcpy(dst_data + dst_idx, src_data + src_idx, src_strides[src_strides.size() - 1]);
-        // update indexes
-        for (size_t i = 0; i < cur_pos.size(); i++) {
-            size_t inverted_idx = cur_pos.size() - i - 1;
-            cur_pos[inverted_idx]++;
-            if (cur_pos[inverted_idx] != max_pos[inverted_idx]) {
-                break;
-            }
-            if (inverted_idx)
-                cur_pos[inverted_idx] = 0;
-            else
-                finish = true;
-        }
-        src_idx = update_index(cur_pos, max_pos, src_strides);
-        dst_idx = update_index(cur_pos, max_pos, dst_strides);
+    if (is_scalar(get_shape()) && is_scalar(dst->get_shape())) {
+        copy_strided(dst_data,
+                     src_data,
+                     ov::Shape{1},
+                     ov::Strides{dst_type.size()},
+                     ov::Strides{src_type.size()},
+                     dst_type.size(),
+                     src_type.size(),
+                     convert,
+                     non_temporal);
+    } else {
+        copy_strided(dst_data,
+                     src_data,
+                     get_shape(),
+                     dst->get_strides(),
+                     get_strides(),
+                     dst_type.size(),
+                     src_type.size(),
+                     convert,
+                     non_temporal);
     }
 }
 
@@ -576,6 +576,38 @@ INSTANTIATE_TEST_SUITE_P(copy_tests,
                                                               TestParams {
                                                                   ov::Shape{}, {}, 
                                                                   {1}, {}
+                                                              },
+                                                              TestParams {
+                                                                  ov::Shape{16, 128, 64}, ov::Strides{65536, 512, 8},
+                                                                  ov::Shape{16, 128, 64}, ov::Strides{}
                                                               }
                                            )));
 // clang-format on
+
+TEST_F(OVTensorTest, copy_to_with_conversion) {
+    const ov::Shape shape{4, 3, 5};
+    const ov::Strides src_strides{128, 32, 4};
+    ov::Tensor full_src_tensor(ov::element::f32, ov::Shape{shape[0] * src_strides[0]});
+    ov::Tensor src_tensor(ov::element::f32, shape, full_src_tensor.data(), src_strides);
+    auto full_src_data = full_src_tensor.data<float>();
+    for (size_t i = 0; i < full_src_tensor.get_size(); i++)
+        full_src_data[i] = static_cast<float>(i) / 3.f;
+
+    ov::Tensor bf16_tensor(ov::element::bf16, shape);
+    src_tensor.copy_to(bf16_tensor);
+    ov::Tensor f32_tensor(ov::element::f32, shape);
+    bf16_tensor.copy_to(f32_tensor);
+
+    auto bf16_data = bf16_tensor.data<ov::bfloat16>();
+    auto f32_data = f32_tensor.data<float>();
+    for (size_t i = 0; i < shape_size(shape); i++) {
+        const size_t src_idx = (i / (shape[1] * shape[2])) * src_strides[0] / 4 +
+                               (i / shape[2] % shape[1]) * src_strides[1] / 4 + (i % shape[2]);
+        const ov::bfloat16 expected(full_src_data[src_idx]);
+        ASSERT_EQ(bf16_data[i].to_bits(), expected.to_bits());
+        ASSERT_EQ(f32_data[i], static_cast<float>(expected));
+    }
+
+    ov::Tensor i32_tensor(ov::element::i32, shape);
+    ASSERT_THROW(src_tensor.copy_to(i32_tensor), ov::Exception);
+}
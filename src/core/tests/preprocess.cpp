@@ -951,6 +951,25 @@ TEST(pre_post_process, resize_with_bicubic_pillow) {
     EXPECT_EQ(f->output().get_partial_shape(), (PartialShape{1, 3, 100, 100}));
 }
 
+TEST(pre_post_process, resize_to_dynamic_model_shape) {
+    const auto f = create_simple_function(element::f32, PartialShape{1, 3, -1, -1});
+
+    auto p = PrePostProcessor(f);
+    p.input().tensor().set_shape({1, 720, 1280, 3}).set_layout("NHWC");
+    // model height/width are not known, target size is provided at inference time
+    p.input().preprocess().resize(ResizeAlgorithm::RESIZE_LINEAR);
+    p.input().model().set_layout("NCHW");
+    p.build();
+
+    ASSERT_EQ(f->get_parameters().size(), 2);
+    EXPECT_EQ(f->input(0).get_partial_shape(), (PartialShape{1, 720, 1280, 3}));
+    EXPECT_EQ(f->input(1).get_element_type(), element::i64);
+    EXPECT_EQ(f->input(1).get_partial_shape(), (PartialShape{2}));
+    EXPECT_EQ(f->input(1).get_tensor().get_names(), std::unordered_set<std::string>{"tensor_input1/resize_size"});
+    EXPECT_EQ(f->get_parameters()[1]->get_friendly_name(), "input1/resize_size");
+    EXPECT_EQ(f->output().get_partial_shape(), (PartialShape{1, 3, -1, -1}));
+}
+
 // Error cases for 'resize'
 TEST(pre_post_process, tensor_spatial_shape_no_layout_dims) {
     auto f = create_simple_function(element::f32, Shape{1, 3, 224, 224});
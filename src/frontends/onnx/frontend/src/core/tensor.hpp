@@ -108,11 +108,17 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir, const bool enable_mmap)
+    /// \param model_proto  Optional owner of the tensor proto. When it is provided, constants created from raw data
+    ///                     point into the proto and keep it alive instead of copying the data.
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    const bool enable_mmap,
+                    const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
           m_model_dir{model_dir},
-          m_enable_mmap{enable_mmap} {
+          m_enable_mmap{enable_mmap},
+          m_model_proto{model_proto} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -237,24 +243,12 @@ private:
                                           std::is_same<T, uint64_t>::value,
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
+        if (has_external_data() || m_tensor_proto->has_raw_data()) {
+            return make_ng_constant_from_buffer(type);
+        }
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         size_t data_size = get_data_size();
-        if (has_external_data()) {
-            const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
-            if (m_enable_mmap) {
-                constant = std::make_shared<ngraph::op::Constant>(type,
-                                                                  m_shape,
-                                                                  ext_data.load_external_mmap_data(m_model_dir));
-            } else {
-                constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, ext_data.load_external_data(m_model_dir));
-            }
-            if (constant->get_byte_size() != ov::shape_size(m_shape) * type.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -274,6 +268,9 @@ private:
                                           !std::is_same<T, uint64_t>::value,
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
+        if (has_external_data() || m_tensor_proto->has_raw_data()) {
+            return make_ng_constant_from_buffer(type);
+        }
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         auto data = get_data<T>();
         auto data_size = data.size();
@@ -290,6 +287,54 @@ private:
         return constant;
     }
 
+    /// \brief      Creates a constant from external or raw data, whose byte layout matches the constant's one
+    ///             for every supported type. External data is mapped or read once; raw data is shared with
+    ///             the model proto when its owner is known.
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_buffer(const element::Type& type) const {
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        const size_t byte_size = ov::shape_size(m_shape) * type.size();
+        if (has_external_data()) {
+            const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
+            if (m_enable_mmap) {
+                constant = std::make_shared<ngraph::op::Constant>(type,
+                                                                  m_shape,
+                                                                  ext_data.load_external_mmap_data(m_model_dir));
+            } else {
+                constant =
+                    std::make_shared<ngraph::op::Constant>(type, m_shape, ext_data.load_external_data(m_model_dir));
+            }
+            if (constant->get_byte_size() != byte_size) {
+                throw error::invalid_external_data(
+                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                    "' in the model");
+            }
+        } else {
+            const auto& raw_data = m_tensor_proto->raw_data();
+            if (raw_data.size() == byte_size) {
+                if (m_model_proto) {
+                    OPENVINO_SUPPRESS_DEPRECATED_START
+                    using ProtoBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>;
+                    auto buffer = std::make_shared<ProtoBuffer>(const_cast<char*>(raw_data.data()),
+                                                                raw_data.size(),
+                                                                m_model_proto);
+                    OPENVINO_SUPPRESS_DEPRECATED_END
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                } else {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, raw_data.data());
+                }
+            } else if (raw_data.empty() && m_shape.size() == 0) {
+                constant = common::make_failsafe_constant(type);
+            } else {
+                throw error::tensor::shape_doesnt_match_data_size{};
+            }
+        }
+
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() ==
@@ -352,6 +397,7 @@ private:
     Shape m_shape;
     std::string m_model_dir;
     bool m_enable_mmap = true;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
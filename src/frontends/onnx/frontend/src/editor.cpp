@@ -302,6 +302,14 @@ struct onnx_editor::ONNXModelEditor::Impl {
         graph_topological_sort(m_model_proto->mutable_graph());
     }
 
+    /// \brief Constants of the models converted earlier point into the initializers of the proto and share its
+    ///        ownership, so a shared proto is copied before its initializers are modified or removed.
+    void detach_model_proto() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+        }
+    }
+
     Impl(const std::string& model_path)
         : Impl(std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))) {}
 
@@ -453,6 +461,7 @@ void onnx_editor::ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>
         return;
     }
 
+    m_pimpl->detach_model_proto();
     if (!outputs.empty()) {
         m_pimpl->m_model_proto->mutable_graph()->mutable_output()->Clear();
     }
@@ -540,6 +549,7 @@ std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->detach_model_proto();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
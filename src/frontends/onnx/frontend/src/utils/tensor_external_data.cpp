@@ -5,7 +5,9 @@
 #include "utils/tensor_external_data.hpp"
 
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
@@ -16,6 +18,32 @@ OPENVINO_SUPPRESS_DEPRECATED_START
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+namespace {
+// Initializers of large models are usually stored in a few external files. Every file is mapped once and the mapping
+// is shared by all the constants pointing into it; the weak reference keeps it alive only while such constants exist.
+std::shared_ptr<ov::MappedMemory> map_external_data_file(const std::string& full_path, const int64_t file_size) {
+    static std::mutex mappings_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<ov::MappedMemory>> mappings;
+
+    std::lock_guard<std::mutex> lock(mappings_mutex);
+    // drop the files no constant points into anymore, so the cache does not grow with every model read
+    for (auto it = mappings.begin(); it != mappings.end();) {
+        if (it->second.expired()) {
+            it = mappings.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    auto& cached = mappings[full_path];
+    auto mapped_memory = cached.lock();
+    if (!mapped_memory || mapped_memory->size() != static_cast<size_t>(file_size)) {
+        mapped_memory = ov::load_mmap_object(full_path);
+        cached = mapped_memory;
+    }
+    return mapped_memory;
+}
+}  // namespace
+
 TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor) {
     for (const auto& entry : tensor.external_data()) {
         if (entry.key() == "location") {
@@ -43,13 +71,15 @@ Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::
     if (file_size <= 0 || m_offset + m_data_length > static_cast<uint64_t>(file_size)) {
         throw error::invalid_external_data{*this};
     }
-    auto mapped_memory = ov::load_mmap_object(full_path, m_data_length, m_offset);
-    if (m_data_length > mapped_memory->size() || mapped_memory->size() == 0) {
+    auto mapped_memory = map_external_data_file(full_path, file_size);
+    if (m_offset + m_data_length > mapped_memory->size() || mapped_memory->size() == 0) {
         throw error::invalid_external_data{*this};
     }
-    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mapped_memory->data(),
-                                                                                              mapped_memory->size(),
-                                                                                              mapped_memory);
+    const uint64_t data_length = m_data_length > 0 ? m_data_length : mapped_memory->size() - m_offset;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+        mapped_memory->data() + m_offset,
+        data_length,
+        mapped_memory);
 }
 
 Buffer<ngraph::runtime::AlignedBuffer> TensorExternalData::load_external_data(const std::string& model_dir) const {
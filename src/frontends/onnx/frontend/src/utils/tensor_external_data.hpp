@@ -31,6 +31,9 @@ public:
 
     /// \brief      Map (mmap for lin, MapViewOfFile for win) external data from tensor passed to constructor
     ///
+    /// \note       Every external data file is mapped once and shared by all the tensors located in it,
+    ///             the returned buffer is a view into that mapping.
+    ///
     /// \note       If read data from external file fails,
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
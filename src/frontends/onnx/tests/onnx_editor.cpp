@@ -1411,6 +1411,34 @@ OPENVINO_TEST(onnx_editor, values__modify_two_initializers) {
     test_case.run();
 }
 
+OPENVINO_TEST(onnx_editor, values__converted_model_outlives_initializers_modification) {
+    onnx_editor::ONNXModelEditor editor{
+        ngraph::file_util::path_join(ov::test::utils::getExecutableDirectory(),
+                                     SERIALIZED_ZOO,
+                                     "onnx/model_editor/add_1D_with_initializers.onnx")};
+    // the new values are stored as raw data, which the constants of the converted model point into
+    std::map<std::string, std::shared_ptr<ngraph::op::Constant>> in_vals;
+    in_vals.emplace("A", ngraph::op::Constant::create(element::i64, Shape{2}, {3, 6}));
+    in_vals.emplace("B", ngraph::op::Constant::create(element::i64, Shape{2}, {2, 1}));
+    editor.set_input_values(in_vals);
+    const auto first_function = editor.get_function();
+
+    in_vals.clear();
+    in_vals.emplace("A", ngraph::op::Constant::create(element::i64, Shape{2}, {10, 20}));
+    in_vals.emplace("B", ngraph::op::Constant::create(element::i64, Shape{2}, {30, 40}));
+    editor.set_input_values(in_vals);
+    const auto second_function = editor.get_function();
+
+    // modifying the initializers again must not change the constants of the first model
+    auto first_test_case = ngraph::test::TestCase(first_function);
+    first_test_case.add_expected_output<int64_t>(Shape{2}, {5, 7});
+    first_test_case.run();
+
+    auto second_test_case = ngraph::test::TestCase(second_function);
+    second_test_case.add_expected_output<int64_t>(Shape{2}, {40, 60});
+    second_test_case.run();
+}
+
 OPENVINO_TEST(onnx_editor, values__no_inputs_modify_two_initializers) {
     onnx_editor::ONNXModelEditor editor{
         ngraph::file_util::path_join(ov::test::utils::getExecutableDirectory(),
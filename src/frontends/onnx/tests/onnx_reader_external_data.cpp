@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <map>
 #include <set>
 #include <streambuf>
 #include <string>
@@ -18,6 +19,7 @@
 #include "ie_core.hpp"
 #include "ngraph/ngraph.hpp"
 #include "openvino/frontend/manager.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/openvino.hpp"
 
 // API 1.0 tests
@@ -274,6 +276,29 @@ TEST_P(OnnxFeMmapFixture, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+TEST(OnnxFeMmap, onnx_external_two_tensors_share_file_mapping) {
+    const auto path = ov::test::utils::getModelFromTestModelZoo(
+        std::string(ONNX_TEST_MODELS) + "external_data/external_data_two_tensors_data_in_the_same_file.onnx");
+    ov::Core core;
+    core.set_property(ov::enable_mmap(true));
+    const auto model = core.read_model(path);
+
+    std::map<std::string, std::shared_ptr<ov::op::v0::Constant>> constants;
+    for (const auto& op : model->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    // data_a and data_b are stored at offsets 0 and 4096 of one file, which is mapped once for both of them
+    const auto data_a = constants["data_a"]->get_data_ptr<uint8_t>();
+    const auto data_b = constants["data_b"]->get_data_ptr<uint8_t>();
+    ASSERT_EQ(data_b - data_a, 4096);
+    ASSERT_EQ(constants["data_a"]->cast_vector<int32_t>(), (std::vector<int32_t>{3, 2, 1}));
+    ASSERT_EQ(constants["data_b"]->cast_vector<int32_t>(), (std::vector<int32_t>{1, 2, 3}));
+}
+
 TEST_P(OnnxFeMmapFixture, onnx_external_invalid_external_data_exception) {
     try {
         const auto path = ov::test::utils::getModelFromTestModelZoo(std::string(ONNX_TEST_MODELS) +
@@ -7,6 +7,7 @@
 #include "helper_ops/string_constant.hpp"
 #include "helper_ops/unsupported_constant.hpp"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/opsets/opset8.hpp"
 #include "tensor_bundle.pb.h"
 
@@ -19,29 +20,35 @@ namespace frontend {
 namespace tensorflow {
 namespace op {
 
-// Reading variable from shard file
+// Reading variable from shard file. The constant refers to the mapped shard memory, so the data is neither copied
+// nor read from disk until it is accessed.
 template <typename T>
 static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> var_index,
                                                const ov::element::Type ov_type,
                                                const ov::Shape shape,
                                                const ::tensorflow::BundleEntryProto& entry,
                                                const NodeContext& node) {
-    std::vector<T> var_data;
     google::protobuf::int64 size = 1;
     for (uint64_t i = 0; i < shape.size(); ++i) {
         size *= static_cast<google::protobuf::int64>(shape[i]);
     }
-    var_data.resize(size);
     TENSORFLOW_OP_VALIDATION(node,
                              size == static_cast<google::protobuf::int64>(entry.size() / sizeof(T)),
                              "[TensorFlow Frontend] Internal error: Available data size isn't equal to calculated.");
-    auto fs = var_index->get_data_file(entry.shard_id());
-    if (!fs.get()) {
+    auto mapped_memory = var_index->get_data_file(entry.shard_id());
+    if (!mapped_memory.get()) {
         TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
     }
-    fs->seekg(entry.offset(), std::ios::beg);
-    fs->read(reinterpret_cast<char*>(var_data.data()), entry.size());
-    return std::make_shared<Constant>(ov_type, shape, var_data);
+    TENSORFLOW_OP_VALIDATION(node,
+                             static_cast<size_t>(entry.offset() + entry.size()) <= mapped_memory->size(),
+                             "[TensorFlow Frontend] Internal error: Variable entry is out of shard file bounds.");
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    auto shared_buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+        mapped_memory->data() + entry.offset(),
+        entry.size(),
+        mapped_memory);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+    return std::make_shared<Constant>(ov_type, shape, shared_buffer);
 }
 
 OutputVector translate_varhandle_op(const NodeContext& node) {
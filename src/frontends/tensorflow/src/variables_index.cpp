@@ -4,8 +4,11 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <fstream>
+#include <future>
 #include <string>
+#include <thread>
 
 #include "checkpoint_utils.hpp"
 #include "graph_iterator_saved_model.hpp"
@@ -21,11 +24,11 @@ namespace ov {
 namespace frontend {
 namespace tensorflow {
 
-void VariablesIndex::read_variables_index_block(std::ifstream& fs,
+void VariablesIndex::read_variables_index_block(const std::vector<char>& index_data,
                                                 const VIBlock& index,
                                                 std::vector<char>& data,
                                                 uint32_t& offset,
-                                                uint32_t& offset_end) {
+                                                uint32_t& offset_end) const {
     size_t block_size = index.m_size;
     data.clear();
     data.resize(block_size + BLOCK_TRAILER_SIZE);
@@ -33,8 +36,7 @@ void VariablesIndex::read_variables_index_block(std::ifstream& fs,
                             "Block offset is bigger than variables index size");
     FRONT_END_GENERAL_CHECK(index.m_offset + data.size() <= m_variables_index_size,
                             "Block size is bigger than variables index size");
-    fs.seekg(index.m_offset, std::ios::beg);
-    fs.read(data.data(), data.size());
+    std::copy_n(index_data.begin() + index.m_offset, data.size(), data.begin());
 #ifndef ENABLE_SNAPPY_COMPRESSION
     FRONT_END_GENERAL_CHECK(data[block_size] == 0, "Compressed files aren't supported");
 #else
@@ -62,7 +64,7 @@ void VariablesIndex::read_variables_index_pair(char*& ptr,
                                                const char* ptr_end,
                                                std::string& key,
                                                char*& value,
-                                               uint32_t& val_length) {
+                                               uint32_t& val_length) const {
     uint32_t shared, nonShared;
     shared = smUnpack<uint32_t>(ptr, ptr_end);
     nonShared = smUnpack<uint32_t>(ptr, ptr_end);
@@ -89,12 +91,18 @@ void VariablesIndex::read_variables_index(std::ifstream& fs, std::map<std::strin
 
     footer.read(fs);
 
+    // The index is read at once, blocks are decoded from memory afterwards
+    std::vector<char> indexData(m_variables_index_size);
+    fs.seekg(0, std::ios::beg);
+    fs.read(indexData.data(), indexData.size());
+    FRONT_END_GENERAL_CHECK(static_cast<size_t>(fs.gcount()) == indexData.size(), "Cannot read variables index");
+
     std::vector<VIBlock> secondLevel;
     std::vector<char> blockData;
 
     uint32_t offset = 0, offset_end = 0;
 
-    read_variables_index_block(fs, footer.m_index, blockData, offset, offset_end);
+    read_variables_index_block(indexData, footer.m_index, blockData, offset, offset_end);
     char *ptr = blockData.data() + offset, *ptr_end = blockData.data() + offset_end, *value = nullptr;
     std::string key = "";
     uint32_t valLength;
@@ -108,15 +116,47 @@ void VariablesIndex::read_variables_index(std::ifstream& fs, std::map<std::strin
         ptr = value + valLength;
     }
 
-    for (auto& block : secondLevel) {
-        read_variables_index_block(fs, block, blockData, offset, offset_end);
+    // Data blocks are independent (each one restarts key prefix compression and may be compressed on its own),
+    // so large indexes of embedding-heavy models are decoded by several threads and merged in the original order
+    std::vector<std::vector<std::pair<std::string, std::vector<char>>>> blockEntries(secondLevel.size());
+    auto decodeBlocks = [&](size_t begin, size_t end) {
+        std::vector<char> data;
+        uint32_t dataOffset = 0, dataOffsetEnd = 0;
+        for (size_t i = begin; i < end; ++i) {
+            read_variables_index_block(indexData, secondLevel[i], data, dataOffset, dataOffsetEnd);
+
+            std::string blockKey = "";
+            char* blockPtr = data.data() + dataOffset;
+            char* blockPtrEnd = data.data() + dataOffsetEnd;
+            char* blockValue = nullptr;
+            uint32_t blockValLength;
+            while (blockPtr < blockPtrEnd) {
+                read_variables_index_pair(blockPtr, blockPtrEnd, blockKey, blockValue, blockValLength);
+                blockEntries[i].emplace_back(blockKey, std::vector<char>(blockValue, blockValue + blockValLength));
+            }
+        }
+    };
+
+    const size_t minBlocksPerThread = 8;
+    const size_t threadsNum = std::max<size_t>(
+        1,
+        std::min<size_t>(std::thread::hardware_concurrency(), secondLevel.size() / minBlocksPerThread));
+    std::vector<std::future<void>> jobs;
+    for (size_t thread = 1; thread < threadsNum; ++thread) {
+        jobs.push_back(std::async(std::launch::async,
+                                  decodeBlocks,
+                                  secondLevel.size() * thread / threadsNum,
+                                  secondLevel.size() * (thread + 1) / threadsNum));
+    }
+    decodeBlocks(0, secondLevel.size() / threadsNum);
+    for (auto& job : jobs) {
+        // rethrows decoding errors of the worker threads
+        job.get();
+    }
 
-        key = "";
-        ptr = blockData.data() + offset;
-        ptr_end = blockData.data() + offset_end;
-        while (ptr < ptr_end) {
-            read_variables_index_pair(ptr, ptr_end, key, value, valLength);
-            varIndex[key] = std::vector<char>(value, value + valLength);
+    for (auto& entries : blockEntries) {
+        for (auto& entry : entries) {
+            varIndex[entry.first] = std::move(entry.second);
         }
     }
 }
@@ -153,22 +193,23 @@ void VariablesIndex::read_checkpointable_object_graph() {
     auto shard = m_data_files.find(entry.shard_id());
     FRONT_END_GENERAL_CHECK(shard != m_data_files.end(), "CMO: data files isn't found");
 
-    std::vector<char> data(entry.size());
     ::tensorflow::TrackableObjectGraph tog;
 
     // TODO: have to understand this offset
     // It looks like reinterpret_cast artifact
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L70
     int chg = 6;
-    shard->second->seekg(entry.offset() + chg);
-    shard->second->read(data.data(), entry.size() - chg);
+    FRONT_END_GENERAL_CHECK(entry.size() >= chg, "CMO: Trackable Object Graph has wrong size");
+    FRONT_END_GENERAL_CHECK(static_cast<size_t>(entry.offset() + entry.size()) <= shard->second->size(),
+                            "CMO: Trackable Object Graph is out of data file bounds");
+    const char* data = shard->second->data() + entry.offset() + chg;
 
     // Might be need to remove this verification:
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L73
     // FRONT_END_GENERAL_CHECK(tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg), "CMO: Trackable
     // Object Graph couldn't be read");
 
-    tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg);
+    tog.ParseFromArray(data, static_cast<int>(entry.size()) - chg);
 
     for (const auto& node : tog.nodes()) {
         for (const auto& attr : node.attributes()) {
@@ -191,9 +232,8 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string&
         } else {
             fullPath = path + "." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        FRONT_END_GENERAL_CHECK(ov::util::file_exists(fullPath), "Variable index data file does not exist");
+        m_data_files[shard] = ov::load_mmap_object(fullPath);
     }
 
     read_checkpointable_object_graph();
@@ -215,9 +255,8 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring
         } else {
             fullPath = path + L"." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        FRONT_END_GENERAL_CHECK(ov::util::file_exists(fullPath), "Variable index data file does not exist");
+        m_data_files[shard] = ov::load_mmap_object(fullPath);
     }
 
     read_checkpointable_object_graph();
@@ -8,6 +8,7 @@
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "saved_model.pb.h"
 
 namespace ov {
@@ -24,8 +25,9 @@ class VariablesIndex {
     int32_t m_total_shards;
     // Contains BundleEntryProto variables list, readed from .index file
     std::map<std::string, std::vector<char>> m_variables_index;
-    // List of opened data files for using with BundleEntryProto
-    std::map<int32_t, std::shared_ptr<std::ifstream>> m_data_files;
+    // List of mapped data files for using with BundleEntryProto. Pages are read on demand
+    // and constants created from variables point directly into the mappings
+    std::map<int32_t, std::shared_ptr<ov::MappedMemory>> m_data_files;
     // List of mapped variables which could be read using TrackableObjectGraph
     std::map<std::string, std::string> m_variables_map;
 
@@ -87,8 +89,8 @@ public:
 
     /// \brief Returns shared pointer to a requested shard_id, or nullptr in case of shard_id isn't found
     /// \param shard_id Requested shard_id
-    /// \returns Valid shared_ptr with ifstream or with nullptr if shard isn't found
-    std::shared_ptr<std::ifstream> get_data_file(const int32_t shard_id) const {
+    /// \returns Valid shared_ptr with mapped shard memory or with nullptr if shard isn't found
+    std::shared_ptr<ov::MappedMemory> get_data_file(const int32_t shard_id) const {
         auto result = m_data_files.find(shard_id);
         return result != m_data_files.end() ? result->second : nullptr;
     }
@@ -117,17 +119,17 @@ public:
                                    std::map<std::string, std::string>& variables_map);
 
 private:
-    /// \brief Reads block structure of .index file
-    /// \param[in,out] fs Filestream of .index file, position in file will be updated
+    /// \brief Reads block structure of .index file. Doesn't modify the object, so blocks can be read concurrently
+    /// \param[in] index_data Content of .index file
     /// \param[in] index Variables index block which stores information about block
     /// \param[out] data Block data will be readed
     /// \param[out] offset Offset of block start
     /// \param[out] offset_end Offset of block end
-    void read_variables_index_block(std::ifstream& fs,
+    void read_variables_index_block(const std::vector<char>& index_data,
                                     const VIBlock& index,
                                     std::vector<char>& data,
                                     uint32_t& offset,
-                                    uint32_t& offset_end);
+                                    uint32_t& offset_end) const;
     /// \brief Reads key=value pair from provided pointer
     /// \param[in,out] ptr Actual pointer, will be moved to the end of readed pair (to read next)
     /// \param[in] ptr_end End of memory which shouldn't be passed in case of broken structure
@@ -138,8 +140,9 @@ private:
                                    const char* ptr_end,
                                    std::string& key,
                                    char*& value,
-                                   uint32_t& val_length);
-    /// \brief Reads .index file and stores key=value map in provided varIndex
+                                   uint32_t& val_length) const;
+    /// \brief Reads .index file and stores key=value map in provided varIndex.
+    /// The file is read at once and its data blocks are decoded in parallel.
     /// \param[in,out] fs Filestream should be parsed. Position in file will be updated
     /// \param[out] varIndex Variables indx (key=value) from given filestream
     void read_variables_index(std::ifstream& fs, std::map<std::string, std::vector<char>>& varIndex);
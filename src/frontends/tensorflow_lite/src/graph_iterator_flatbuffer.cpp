@@ -12,19 +12,29 @@ using namespace ov::frontend::tensorflow_lite;
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
-    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path)) {}
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path, const bool enable_mmap)
+    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path), enable_mmap) {}
 
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path, const bool enable_mmap) {
+    const uint8_t* model_data = nullptr;
+    if (enable_mmap) {
+        // the flatbuffer is parsed in place and constant buffers are shared with the mapping
+        FRONT_END_GENERAL_CHECK(ov::util::file_exists(path), "Model file does not exist: ", path);
+        m_mapped_memory = ov::load_mmap_object(path);
+        FRONT_END_GENERAL_CHECK(m_mapped_memory->size() > 0, "Model file is empty: ", path);
+        model_data = reinterpret_cast<const uint8_t*>(m_mapped_memory->data());
+    } else {
+        std::ifstream model_file(path, std::ios::binary | std::ios::in);
+        FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
 
-    m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
-    model_file.close();
+        m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
+        model_file.close();
+        model_data = m_data.data();
+    }
 
-    m_model = tflite::GetModel(m_data.data());
+    m_model = tflite::GetModel(model_data);
     auto sub_graphs = m_model->subgraphs();
     m_subgraphs = {sub_graphs->begin(), sub_graphs->end()};
     m_graph = m_subgraphs[0];
@@ -47,6 +57,7 @@ std::shared_ptr<GraphIteratorFlatBuffer> GraphIteratorFlatBuffer::get_subgraph(c
     auto iterator = std::make_shared<GraphIteratorFlatBuffer>();
     iterator->node_index = 0;
     iterator->m_model = m_model;
+    iterator->m_mapped_memory = m_mapped_memory;
     iterator->m_subgraphs = {};  // TODO: check if we need to pass all sub-graphs here (while in a while situation)
     iterator->m_graph = m_subgraphs[idx];
     const auto operators = iterator->m_graph->operators();
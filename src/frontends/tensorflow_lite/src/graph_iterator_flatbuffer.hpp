@@ -9,6 +9,7 @@
 #include "openvino/core/any.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -24,6 +25,8 @@ struct TensorInfo {
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
     std::vector<uint8_t> m_data;
+    // mapped model file, set instead of m_data when the model is loaded with mmap
+    std::shared_ptr<ov::MappedMemory> m_mapped_memory;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -31,10 +34,10 @@ class GraphIteratorFlatBuffer {
 
 public:
     GraphIteratorFlatBuffer() = default;
-    explicit GraphIteratorFlatBuffer(const std::string& path);
+    explicit GraphIteratorFlatBuffer(const std::string& path, const bool enable_mmap = false);
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-    explicit GraphIteratorFlatBuffer(const std::wstring& path);
+    explicit GraphIteratorFlatBuffer(const std::wstring& path, const bool enable_mmap = false);
 #endif
 
     using Ptr = std::shared_ptr<GraphIteratorFlatBuffer>;
@@ -69,6 +72,12 @@ public:
     /// If there is no query for specific sub-graph iterator shouldn't be created
     /// idx should be in range 0..get_subgraph_size()-1
     std::shared_ptr<GraphIteratorFlatBuffer> get_subgraph(const size_t& idx) const;
+
+    /// \brief Returns the mapped model file the flatbuffer is parsed from
+    /// nullptr if the model file was read into memory
+    std::shared_ptr<ov::MappedMemory> get_mapped_memory() const {
+        return m_mapped_memory;
+    }
 };
 
 }  // namespace tensorflow_lite
@@ -8,6 +8,7 @@
 #include <queue>
 
 #include "openvino/frontend/exception.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "openvino/util/log.hpp"
 #include "tensor_lite_place.hpp"
@@ -19,6 +20,35 @@ namespace ov {
 namespace frontend {
 namespace tensorflow_lite {
 
+namespace {
+// Creates the constant of a tensor buffer: a view into the model file mapping when the model is mapped,
+// a copy of the buffer otherwise. Quantized tensors take the same path, the dequantization subgraph created by
+// the quantize resolver reads their integer data directly from the mapping.
+std::shared_ptr<ov::op::v0::Constant> create_constant(const std::shared_ptr<TensorLitePlace>& place,
+                                                      const void* data,
+                                                      const std::shared_ptr<ov::MappedMemory>& mapped_memory) {
+    const auto& type = place->get_element_type();
+    const auto shape = place->get_partial_shape().to_shape();
+    if (mapped_memory && type.is_static()) {
+        const size_t byte_size = (shape_size(shape) * type.bitwidth() + 7) / 8;
+        const char* mapping_begin = mapped_memory->data();
+        const char* mapping_end = mapping_begin + mapped_memory->size();
+        const char* buffer_begin = static_cast<const char*>(data);
+        if (buffer_begin >= mapping_begin && buffer_begin <= mapping_end &&
+            byte_size <= static_cast<size_t>(mapping_end - buffer_begin)) {
+            OPENVINO_SUPPRESS_DEPRECATED_START
+            auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                const_cast<char*>(buffer_begin),
+                byte_size,
+                mapped_memory);
+            OPENVINO_SUPPRESS_DEPRECATED_END
+            return std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+        }
+    }
+    return ov::op::v0::Constant::create(type, shape, data);
+}
+}  // namespace
+
 class InputModel::InputModelTFLiteImpl {
 public:
     InputModelTFLiteImpl(const GraphIteratorFlatBuffer::Ptr& graph_iterator,
@@ -110,9 +140,7 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant = create_constant(place, data, m_graph_iterator->get_mapped_memory());
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
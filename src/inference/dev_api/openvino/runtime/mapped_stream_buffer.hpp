@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for a stream buffer over a mapped file
+ * @file openvino/runtime/mapped_stream_buffer.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+
+/**
+ * @brief Read-only stream buffer over a mapped file.
+ * Readers that recognize it may keep the mapping and reference the data in place instead of reading it,
+ * e.g. a plugin importing a compiled model from a mapped cache blob leaves the weights in the mapping,
+ * so they are paged in on first use.
+ * @ingroup ov_dev_api_plugin_api
+ */
+class MappedStreamBuffer : public std::streambuf {
+public:
+    explicit MappedStreamBuffer(std::shared_ptr<ov::MappedMemory> mapped_memory)
+        : m_mapped_memory(std::move(mapped_memory)) {
+        char* begin = m_mapped_memory->data();
+        setg(begin, begin, begin + m_mapped_memory->size());
+    }
+
+    /**
+     * @brief Returns the mapping the stream reads from
+     */
+    const std::shared_ptr<ov::MappedMemory>& get_mapped_memory() const {
+        return m_mapped_memory;
+    }
+
+    /**
+     * @brief Returns the current read position from the beginning of the mapping
+     */
+    size_t get_offset() const {
+        return static_cast<size_t>(gptr() - eback());
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+        if (off < eback() - base || off > egptr() - base) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), base + off, egptr());
+        return pos_type(gptr() - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    std::streamsize showmanyc() override {
+        return egptr() - gptr();
+    }
+
+private:
+    std::shared_ptr<ov::MappedMemory> m_mapped_memory;
+};
+
+}  // namespace ov
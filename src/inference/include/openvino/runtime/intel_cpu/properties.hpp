@@ -11,6 +11,8 @@
  */
 #pragma once
 
+#include <map>
+
 #include "openvino/runtime/properties.hpp"
 
 namespace ov {
@@ -55,7 +57,9 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  * plugin at the model compilation stage and store non-zero values in a special packed format. Then, during the
  * execution of the model, the weights are unpacked and used in the computational kernel. Since the weights are loaded
  * from DDR/L3 cache in the packed format this significantly decreases memory consumption and as a consequence improve
- * inference performance. The following code allows to set the sparse rate value.
+ * inference performance. On the platforms without AMX the FullyConnected operations with the f32/bf16 weights having
+ * the structured sparsity (2:4, 4:8 or zero blocks) use the kernels computing on the packed non-zero values.
+ * The following code allows to set the sparse rate value.
  *
  * @code
  * core.set_property(ov::intel_cpu::sparse_weights_decompression_rate(0.8));
@@ -63,5 +67,161 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property enables sharing of the packed weights between all the CPU compiled models of the process
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The packed weights are looked up by their content, so compiled models built from the same weights (e.g. variants
+ * of the same model with different batch sizes or streams number, or the models sharing a backbone) keep a single
+ * copy of them. The weights are hashed during the compilation, so the feature is disabled by default.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::share_weights_across_models(true));
+ * @endcode
+ */
+static constexpr Property<bool> share_weights_across_models{"CPU_SHARE_WEIGHTS_ACROSS_MODELS"};
+
+/**
+ * @brief Read-only property reporting the size in bytes of the packed weights currently shared between the compiled
+ * models, see ov::intel_cpu::share_weights_across_models
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> shared_weights_memory_size{"CPU_SHARED_WEIGHTS_MEMORY_SIZE"};
+
+/**
+ * @brief This property enables the empirical tuning of the streams layout for the ov::hint::PerformanceMode::THROUGHPUT
+ * performance hint
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * During the compilation the plugin runs short timed trials of the candidate layouts (threads per stream and threads
+ * pinning) on the synthetic inputs and keeps the fastest one instead of the heuristic choice. The selected layout is
+ * stored in the model cache (see ov::cache_dir), so the trials run once per model and machine. The property has no
+ * effect when the number of streams is set explicitly or the model has dynamic shapes.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+ *                    ov::intel_cpu::streams_auto_tune(true));
+ * @endcode
+ */
+static constexpr Property<bool> streams_auto_tune{"CPU_STREAMS_AUTO_TUNE"};
+
+/**
+ * @brief This property enables the runtime switching of the compiled model between the latency ("few wide" streams)
+ * and the throughput ("many narrow" streams) layouts depending on the load
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The model is compiled for the layout of the ov::hint::performance_mode hint and the layout of the other hint is
+ * prepared as well. The asynchronous requests are dispatched to the wide streams while the number of the pending
+ * requests does not exceed the number of the wide streams, and to the narrow ones otherwise. The graphs of both layouts
+ * are created on the model compilation, so switching does not stall the requests, and share the weights: only the
+ * per-stream intermediate buffers are allocated for each of them.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+ *                    ov::intel_cpu::elastic_streams(true));
+ * @endcode
+ */
+static constexpr Property<bool> elastic_streams{"CPU_ELASTIC_STREAMS"};
+
+/**
+ * @brief This property enables the dynamic quantization of the FullyConnected (MatMul with constant weights) activations
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The weights are quantized to int8 per output channel at the model compilation stage, and the activations are quantized
+ * per token (row) during the execution, with the scales computed from the actual values. So the int8 kernels are used
+ * for the models which have no FakeQuantize operations from an offline calibration, e.g. LLM or BERT-like models, at
+ * the cost of some accuracy. The property has effect on the platforms with int8 dot product instructions (VNNI) only.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::dynamic_quantization(true));
+ * @endcode
+ */
+static constexpr Property<bool> dynamic_quantization{"CPU_DYNAMIC_QUANTIZATION"};
+
+/**
+ * @brief This property sets the directory of the persistent JIT kernels cache
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The model cache (see ov::cache_dir) keeps the compiled graph only, so the kernels are generated again in every new
+ * process. With the kernels cache the machine code of the kernels is stored on the disk, keyed by the kernel
+ * parameters, the CPU instruction set and the OpenVINO build, and the next processes load it instead of generating.
+ * Only the kernels which do not depend on the process address space are stored. The cache is disabled when the
+ * directory is empty (default) and on the platforms other than Linux.
+ *
+ * @code
+ * core.set_property("CPU", ov::intel_cpu::kernel_cache_dir("/tmp/ov_kernels"));
+ * @endcode
+ */
+static constexpr Property<std::string> kernel_cache_dir{"CPU_KERNEL_CACHE_DIR"};
+
+/**
+ * @brief This property limits the size in bytes of the persistent JIT kernels cache, see ov::intel_cpu::kernel_cache_dir
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The least recently used kernels are removed from the directory when the limit is exceeded.
+ */
+static constexpr Property<uint64_t> kernel_cache_size{"CPU_KERNEL_CACHE_SIZE"};
+
+/**
+ * @brief This property enables the refinement of the memory layouts chosen node by node over the whole graph
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The nodes are switched to the layouts of the same implementation reducing the bytes moved by the reorders between
+ * them, see ov::intel_cpu::reorder_statistics. Disabled by default: only the reorder bytes are counted, so a layout
+ * with fewer reorders may still run slower in the nodes themselves.
+ *
+ * @code
+ * core.set_property("CPU", ov::intel_cpu::layout_optimization(true));
+ * @endcode
+ */
+static constexpr Property<bool> layout_optimization{"CPU_LAYOUT_OPTIMIZATION"};
+
+/**
+ * @brief Read-only property reporting the wall time in milliseconds spent in each stage of the model compilation
+ * (e.g. "InitDescriptors", "CreatePrimitives")
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The descriptors enumeration and the primitives (JIT kernels) creation run concurrently across the graph nodes, so
+ * these timings help to track how the compilation time scales with the number of threads.
+ *
+ * @code
+ * auto timings = compiled_model.get_property(ov::intel_cpu::compile_stage_timings);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, double>, PropertyMutability::RO> compile_stage_timings{
+    "CPU_COMPILE_STAGE_TIMINGS"};
+
+/**
+ * @brief Read-only property reporting the operations fusion coverage of the compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The keys "fused:<node type>+<operation type>" count the operations executed as a part of the other nodes (e.g. as
+ * post-ops), and the keys "unfused:<producer type>+<operation type>" count the Eltwise and FakeQuantize operations
+ * executed standalone, each of them costs an extra pass over the memory.
+ *
+ * @code
+ * auto statistics = compiled_model.get_property(ov::intel_cpu::fusion_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> fusion_statistics{
+    "CPU_FUSION_STATISTICS"};
+
+/**
+ * @brief Read-only property reporting the layout reorders of the compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The keys "before:reorders" and "before:bytes" give the number of the reorders and the bytes they read and write
+ * with the layouts chosen node by node, the keys "after:reorders" and "after:bytes" - the same after the layouts are
+ * refined over the whole graph, they are equal to "before" unless ov::intel_cpu::layout_optimization is enabled. The
+ * dynamic dimensions are estimated by their bounds, the constant inputs are not counted since their reorders are
+ * executed once on the model compilation.
+ *
+ * @code
+ * auto statistics = compiled_model.get_property(ov::intel_cpu::reorder_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> reorder_statistics{
+    "CPU_REORDER_STATISTICS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -110,6 +110,7 @@ private:
         std::shared_ptr<ov::ICacheManager> cacheManager;
         std::string blobId = {};
         std::string modelPath = {};
+        bool mmapEnabled = false;
     };
 
     // Core settings (cache config, etc)
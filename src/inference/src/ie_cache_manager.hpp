@@ -9,13 +9,24 @@
  */
 #pragma once
 
+#include <atomic>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/runtime/mapped_stream_buffer.hpp"
 
 namespace ov {
 
@@ -58,9 +69,10 @@ public:
      * Otherwise, network will not be read from cache and will be loaded as usual
      *
      * @param id Id of cache (hash of the network)
+     * @param enable_mmap Allows to provide a stream over the mapped cache entry, see ov::MappedStreamBuffer
      * @param reader Lambda function to be called when input stream is created
      */
-    virtual void read_cache_entry(const std::string& id, StreamReader reader) = 0;
+    virtual void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) = 0;
 
     /**
      * @brief Callback when Inference Engine intends to remove cache entry
@@ -85,6 +97,14 @@ class FileStorageCacheManager final : public ICacheManager {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    static int getProcessId() {
+#ifdef _WIN32
+        return _getpid();
+#else
+        return getpid();
+#endif
+    }
+
 public:
     /**
      * @brief Constructor
@@ -100,15 +120,49 @@ public:
 
 private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // Other processes may have the current entry mapped, with plugins referencing its pages (see
+        // read_cache_entry), so it is never truncated in place: the new entry is written to a temporary file in
+        // the same directory and renamed over the old one. The mappings keep the old file contents.
+        const auto blobFileName = getBlobFile(id);
+        static std::atomic<size_t> tmpCounter{0};
+        std::stringstream tmpFileName;
+        tmpFileName << blobFileName << "." << getProcessId() << "." << std::this_thread::get_id() << "."
+                    << tmpCounter++ << ".tmp";
+        const auto tmpBlobFileName = tmpFileName.str();
+        try {
+            std::ofstream stream(tmpBlobFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+            stream.close();
+            if (!stream) {
+                std::remove(tmpBlobFileName.c_str());
+                return;
+            }
+        } catch (...) {
+            std::remove(tmpBlobFileName.c_str());
+            throw;
+        }
+        if (std::rename(tmpBlobFileName.c_str(), blobFileName.c_str()) != 0) {
+            // Windows does not rename over an existing file
+            std::remove(blobFileName.c_str());
+            if (std::rename(tmpBlobFileName.c_str(), blobFileName.c_str()) != 0)
+                std::remove(tmpBlobFileName.c_str());
+        }
     }
 
-    void read_cache_entry(const std::string& id, StreamReader reader) override {
+    void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            if (enable_mmap) {
+                // Plugins may keep references into the mapping (e.g. weights) after the import.
+                // Cache entries are never rewritten in place: a new entry replaces the file by a rename
+                // (see write_cache_entry), so the mapped file stays intact.
+                MappedStreamBuffer buffer(ov::load_mmap_object(blobFileName));
+                std::istream stream(&buffer);
+                reader(stream);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream);
+            }
         }
     }
 
@@ -3,13 +3,44 @@
 //
 
 #include "async_infer_request.h"
+#include "exec_network.h"
 #include <memory>
 
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _inferRequest(static_cast<InferRequestBase*>(inferRequest.get())) {
+    _inferRequest->SetAsyncRequest(this);
+
+    auto execNetwork = std::static_pointer_cast<ExecNetwork>(inferRequest->getPointerToExecutableNetworkInternal());
+    if (execNetwork && execNetwork->IsElastic()) {
+        _elasticNetwork = execNetwork;
+        _pipeline = {{taskExecutor, [this] {
+                          try {
+                              _inferRequest->InferImpl();
+                          } catch (...) {
+                              _elasticNetwork->ReleaseStreamsLayout();
+                              throw;
+                          }
+                          _elasticNetwork->ReleaseStreamsLayout();
+                      }}};
+    }
+}
+
+void ov::intel_cpu::AsyncInferRequest::StartAsync_ThreadUnsafe() {
+    if (_elasticNetwork) {
+        const auto layout = _elasticNetwork->AcquireStreamsLayout();
+        _inferRequest->SetStreamsLayout(layout);
+        _pipeline.front().first = _elasticNetwork->GetTaskExecutor(layout);
+    }
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+}
+
+void ov::intel_cpu::AsyncInferRequest::Infer_ThreadUnsafe() {
+    // the synchronous inference runs on the calling thread within the compiled streams layout
+    _inferRequest->SetStreamsLayout(0);
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::Infer_ThreadUnsafe();
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
@@ -18,6 +18,15 @@ public:
                       const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~AsyncInferRequest();
+
+protected:
+    void StartAsync_ThreadUnsafe() override;
+    void Infer_ThreadUnsafe() override;
+
+private:
+    InferRequestBase* _inferRequest = nullptr;
+    // set if the requests are dispatched between the elastic streams layouts
+    std::shared_ptr<ExecNetwork> _elasticNetwork;
 };
 
 }   // namespace intel_cpu
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <functional>
+#include <mutex>
 #include "lru_cache.h"
 
 namespace ov {
@@ -29,6 +30,9 @@ public:
  *         interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note Lookups and insertions are serialized, while the builder runs unlocked, so independent values may be created
+ *       concurrently (e.g. primitives of different nodes during the parallel graph compilation). Two threads missing
+ *       on the same key both build the value and the latter one is stored.
  */
 
 template<typename KeyType,
@@ -55,19 +59,28 @@ public:
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
-        ValType retVal = _impl.get(key);
+        ValType retVal;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            retVal = _impl.get(key);
+        }
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
             retVal = builder(key);
-            if (retVal != retEmpty)
+            if (retVal != retEmpty) {
+                std::lock_guard<std::mutex> lock(_mutex);
                 _impl.put(key, retVal);
+            }
         }
         return {retVal, retStatus};
     }
 
 public:
     ImplType _impl;
+
+private:
+    std::mutex _mutex;
 };
 
 }   // namespace intel_cpu
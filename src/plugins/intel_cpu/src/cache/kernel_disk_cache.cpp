@@ -0,0 +1,500 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kernel_disk_cache.h"
+
+#include "weights_cache.hpp"
+#include "utils/debug_capabilities.h"
+#include "openvino/core/version.hpp"
+#include "openvino/util/file_util.hpp"
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <link.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace {
+
+const std::string fileExt = ".jitk";
+
+uint64_t hashBytes(const void* data, size_t size) {
+    return WeightsSharing::GetHashFunc().hash(static_cast<const unsigned char*>(data), size);
+}
+
+#if defined(__linux__)
+const char fileMagic[8] = {'O', 'V', 'J', 'I', 'T', 'K', '0', '1'};
+
+class Writer {
+public:
+    template <typename T>
+    void put(const T& value) {
+        const auto* bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+    void put(const std::string& value) {
+        put<uint64_t>(value.size());
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+    void put(const std::vector<uint8_t>& value) {
+        put<uint64_t>(value.size());
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    std::vector<char> buffer;
+};
+
+// every read is bounds checked, so a truncated or damaged file is rejected instead of being trusted
+class Reader {
+public:
+    Reader(const char* data, size_t size) : data(data), size(size) {}
+
+    template <typename T>
+    bool get(T& value) {
+        if (size - pos < sizeof(T))
+            return false;
+        std::memcpy(&value, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+    bool get(std::string& value) {
+        uint64_t length = 0;
+        if (!get(length) || size - pos < length)
+            return false;
+        value.assign(data + pos, length);
+        pos += length;
+        return true;
+    }
+    bool get(std::vector<uint8_t>& value) {
+        uint64_t length = 0;
+        if (!get(length) || size - pos < length)
+            return false;
+        value.assign(data + pos, data + pos + length);
+        pos += length;
+        return true;
+    }
+    bool done() const {
+        return pos == size;
+    }
+
+private:
+    const char* data;
+    size_t size;
+    size_t pos = 0;
+};
+
+// the relocations have to be sorted, must not overlap and must point inside the code or the known modules,
+// the targets inside the code must not point into the middle of the relocated addresses
+bool checkRelocations(const KernelDiskCache::Image& image) {
+    const uint64_t codeSize = image.code.size();
+    uint64_t nextFree = 0;
+    for (const auto& r : image.relocations) {
+        if (r.offset < nextFree || r.offset > codeSize || codeSize - r.offset < sizeof(uint64_t))
+            return false;
+        nextFree = r.offset + sizeof(uint64_t);
+        if (r.module == KernelDiskCache::SELF) {
+            if (r.target > codeSize)
+                return false;
+        } else if (r.module < 0 || static_cast<size_t>(r.module) >= image.modules.size()) {
+            return false;
+        }
+    }
+    for (const auto& r : image.relocations) {
+        if (r.module != KernelDiskCache::SELF)
+            continue;
+        for (const auto& other : image.relocations) {
+            if (r.target > other.offset && r.target < other.offset + sizeof(uint64_t))
+                return false;
+        }
+    }
+    return true;
+}
+
+std::string baseName(const char* path) {
+    const char* slash = std::strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+// the address ranges mapped into the process, sorted by the start address
+std::vector<std::pair<uint64_t, uint64_t>> readMappings() {
+    std::vector<std::pair<uint64_t, uint64_t>> mappings;
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line)) {
+        unsigned long long begin = 0, end = 0;
+        if (std::sscanf(line.c_str(), "%llx-%llx", &begin, &end) == 2)
+            mappings.emplace_back(begin, end);
+    }
+    std::sort(mappings.begin(), mappings.end());
+    return mappings;
+}
+
+// the code is mapped executable, so only the files and the directories no other user can modify are trusted
+bool isTrusted(const struct stat& st) {
+    return st.st_uid == geteuid() && (st.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+bool isMapped(const std::vector<std::pair<uint64_t, uint64_t>>& mappings, uint64_t address) {
+    auto it = std::upper_bound(mappings.begin(), mappings.end(), std::make_pair(address, UINT64_MAX));
+    return it != mappings.begin() && address < std::prev(it)->second;
+}
+
+// base addresses of the loaded modules by their file names, the names loaded twice are ambiguous and dropped
+std::unordered_map<std::string, uint64_t> loadedModules() {
+    std::unordered_map<std::string, uint64_t> modules;
+    std::unordered_map<std::string, size_t> counts;
+    auto collect = [&](dl_phdr_info* info) {
+        for (int i = 0; i < info->dlpi_phnum; i++) {
+            if (info->dlpi_phdr[i].p_type != PT_LOAD)
+                continue;
+            Dl_info dlInfo;
+            const auto address = info->dlpi_addr + info->dlpi_phdr[i].p_vaddr;
+            if (dladdr(reinterpret_cast<void*>(address), &dlInfo) && dlInfo.dli_fname && dlInfo.dli_fbase) {
+                const auto name = baseName(dlInfo.dli_fname);
+                modules[name] = reinterpret_cast<uint64_t>(dlInfo.dli_fbase);
+                counts[name]++;
+            }
+            break;
+        }
+    };
+    using Collect = decltype(collect);
+    dl_iterate_phdr([](dl_phdr_info* info, size_t, void* data) {
+        (*static_cast<Collect*>(data))(info);
+        return 0;
+    }, &collect);
+    for (const auto& count : counts) {
+        if (count.second > 1)
+            modules.erase(count.first);
+    }
+    return modules;
+}
+#endif
+
+}  // namespace
+
+KernelDiskCache::KernelDiskCache(std::string dir, uint64_t sizeLimit) : dir(std::move(dir)), sizeLimit(sizeLimit) {}
+
+KernelDiskCache::Ptr KernelDiskCache::get(const std::string& dir, uint64_t sizeLimit) {
+#if defined(__linux__)
+    if (dir.empty())
+        return nullptr;
+
+    static std::mutex registryGuard;
+    static std::unordered_map<std::string, std::weak_ptr<KernelDiskCache>> registry;
+
+    // Xbyak encodes the addresses below 4GB (e.g. the static data of a non-PIE executable) as 32-bit immediates,
+    // which makeImage() can't find, so the cache is only safe when the plugin code is loaded above them
+    Dl_info self;
+    if (!dladdr(reinterpret_cast<const void*>(&KernelDiskCache::get), &self) ||
+        reinterpret_cast<uintptr_t>(self.dli_fbase) <= UINT32_MAX) {
+        DEBUG_LOG("Kernel cache is disabled, the plugin is loaded at the low addresses");
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(registryGuard);
+    auto cache = registry[dir].lock();
+    if (!cache) {
+        const bool created = !ov::util::directory_exists(dir);
+        try {
+            ov::util::create_directory_recursive(dir);
+        } catch (const std::exception& e) {
+            DEBUG_LOG("Kernel cache is disabled, can't create directory ", dir, ": ", e.what());
+            return nullptr;
+        }
+        // the umask may leave the new directory writable by the group
+        if (created)
+            chmod(dir.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+        struct stat st;
+        if (lstat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode) || !isTrusted(st)) {
+            DEBUG_LOG("Kernel cache is disabled, directory ", dir, " is not trusted");
+            return nullptr;
+        }
+        cache = std::make_shared<KernelDiskCache>(dir, sizeLimit);
+        registry[dir] = cache;
+    }
+    return cache;
+#else
+    (void)dir;
+    (void)sizeLimit;
+    return nullptr;
+#endif
+}
+
+std::string KernelDiskCache::fullKey(const std::string& key) const {
+    // the code is valid for the same build only and depends on the ISA extensions available on the CPU
+    return key + "|build=" + ov::get_openvino_version().buildNumber +
+           "|cpu=" + std::to_string(static_cast<int>(dnnl::get_effective_cpu_isa()));
+}
+
+std::string KernelDiskCache::filePath(const std::string& fullKey) const {
+    return ov::util::path_join({dir, std::to_string(hashBytes(fullKey.data(), fullKey.size())) + fileExt});
+}
+
+bool KernelDiskCache::load(const std::string& key, Image& image) {
+#if defined(__linux__)
+    const auto full = fullKey(key);
+    const auto path = filePath(full);
+
+    // the checks are done on the opened file, so it can't be replaced between the check and the read
+    const int fd = open(path.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd < 0) {
+        missesCount++;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || !isTrusted(st)) {
+        DEBUG_LOG("Kernel cache file ", path, " is not owned by the user or is writable by others");
+        close(fd);
+        missesCount++;
+        return false;
+    }
+    std::vector<char> content(static_cast<size_t>(st.st_size));
+    size_t readSize = 0;
+    while (readSize < content.size()) {
+        const auto n = read(fd, content.data() + readSize, content.size() - readSize);
+        if (n <= 0)
+            break;
+        readSize += static_cast<size_t>(n);
+    }
+    close(fd);
+    content.resize(readSize);
+
+    // a damaged file is removed, so the kernel is generated and stored again
+    auto reject = [&]() {
+        DEBUG_LOG("Kernel cache file ", path, " is damaged");
+        std::remove(path.c_str());
+        missesCount++;
+        return false;
+    };
+
+    Reader header(content.data(), content.size());
+    char magic[sizeof(fileMagic)];
+    uint64_t payloadSize = 0, checksum = 0;
+    if (!header.get(magic) || std::memcmp(magic, fileMagic, sizeof(fileMagic)) != 0 ||
+        !header.get(payloadSize) || !header.get(checksum))
+        return reject();
+    const size_t headerSize = sizeof(fileMagic) + 2 * sizeof(uint64_t);
+    if (content.size() - headerSize != payloadSize)
+        return reject();
+    const char* payload = content.data() + headerSize;
+    if (hashBytes(payload, payloadSize) != checksum)
+        return reject();
+
+    Reader reader(payload, payloadSize);
+    std::string storedKey;
+    uint64_t count = 0;
+    image = {};
+    if (!reader.get(storedKey))
+        return reject();
+    if (storedKey != full) {
+        // a hash collision of the file names, not a damaged file
+        missesCount++;
+        return false;
+    }
+    if (!reader.get(image.code) || !reader.get(count))
+        return reject();
+    if (count > payloadSize)
+        return reject();
+    image.modules.resize(count);
+    for (auto& module : image.modules) {
+        if (!reader.get(module))
+            return reject();
+    }
+    if (!reader.get(count) || count > payloadSize)
+        return reject();
+    image.relocations.resize(count);
+    for (auto& r : image.relocations) {
+        if (!reader.get(r.offset) || !reader.get(r.module) || !reader.get(r.target))
+            return reject();
+    }
+    if (!reader.get(image.metadata) || !reader.done() || !checkRelocations(image))
+        return reject();
+
+    if (!image.modules.empty()) {
+        const auto modules = loadedModules();
+        for (const auto& name : image.modules) {
+            auto it = modules.find(name);
+            if (it == modules.end()) {
+                missesCount++;
+                return false;
+            }
+            image.moduleBases.push_back(it->second);
+        }
+    }
+
+    // the access time is tracked by the modification time, which is used by the eviction
+    utime(path.c_str(), nullptr);
+    hitsCount++;
+    return true;
+#else
+    (void)key;
+    (void)image;
+    return false;
+#endif
+}
+
+void KernelDiskCache::store(const std::string& key, const Image& image) {
+#if defined(__linux__)
+    const auto full = fullKey(key);
+
+    Writer payload;
+    payload.put(full);
+    payload.put(image.code);
+    payload.put<uint64_t>(image.modules.size());
+    for (const auto& module : image.modules)
+        payload.put(module);
+    payload.put<uint64_t>(image.relocations.size());
+    for (const auto& r : image.relocations) {
+        payload.put(r.offset);
+        payload.put(r.module);
+        payload.put(r.target);
+    }
+    payload.put(image.metadata);
+
+    Writer file;
+    file.put(fileMagic);
+    file.put<uint64_t>(payload.buffer.size());
+    file.put<uint64_t>(hashBytes(payload.buffer.data(), payload.buffer.size()));
+    file.buffer.insert(file.buffer.end(), payload.buffer.begin(), payload.buffer.end());
+    if (file.buffer.size() > sizeLimit)
+        return;
+
+    // the file is written aside and renamed, so the concurrent processes never see a partially written file
+    const auto path = filePath(full);
+    const auto tmpPath = path + "." + std::to_string(getpid()) + "." + std::to_string(tmpCounter++) + ".tmp";
+    {
+        // the group and the others can't write the file whatever the umask is, see isTrusted()
+        const int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+                            S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        if (fd < 0)
+            return;
+        size_t written = 0;
+        while (written < file.buffer.size()) {
+            const auto n = write(fd, file.buffer.data() + written, file.buffer.size() - written);
+            if (n <= 0)
+                break;
+            written += static_cast<size_t>(n);
+        }
+        if (close(fd) != 0 || written != file.buffer.size()) {
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return;
+    }
+    evict();
+#else
+    (void)key;
+    (void)image;
+#endif
+}
+
+void KernelDiskCache::evict() {
+#if defined(__linux__)
+    std::lock_guard<std::mutex> lock(guard);
+    struct FileInfo {
+        std::string path;
+        uint64_t size;
+        int64_t mtime;
+    };
+    std::vector<FileInfo> files;
+    uint64_t totalSize = 0;
+
+    DIR* directory = opendir(dir.c_str());
+    if (!directory)
+        return;
+    while (dirent* entry = readdir(directory)) {
+        const std::string name = entry->d_name;
+        if (name.size() <= fileExt.size() || name.compare(name.size() - fileExt.size(), fileExt.size(), fileExt) != 0)
+            continue;
+        const auto path = ov::util::path_join({dir, name});
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0)
+            continue;
+        files.push_back({path, static_cast<uint64_t>(st.st_size), static_cast<int64_t>(st.st_mtime)});
+        totalSize += st.st_size;
+    }
+    closedir(directory);
+
+    if (totalSize <= sizeLimit)
+        return;
+    std::sort(files.begin(), files.end(), [](const FileInfo& lhs, const FileInfo& rhs) {
+        return lhs.mtime < rhs.mtime;
+    });
+    for (const auto& file : files) {
+        if (totalSize <= sizeLimit)
+            break;
+        if (std::remove(file.path.c_str()) == 0)
+            totalSize -= file.size;
+    }
+#endif
+}
+
+bool KernelDiskCache::makeImage(const uint8_t* code, size_t size, Image& image) {
+#if defined(__linux__)
+    image = {};
+    image.code.assign(code, code + size);
+    const auto mappings = readMappings();
+    const uint64_t begin = reinterpret_cast<uint64_t>(code);
+    std::map<std::string, int32_t> moduleIds;
+
+    size_t pos = 0;
+    while (pos + sizeof(uint64_t) <= size) {
+        uint64_t value;
+        std::memcpy(&value, code + pos, sizeof(value));
+        const bool inCode = value >= begin && value <= begin + size;
+        if (!inCode && !isMapped(mappings, value)) {
+            pos++;
+            continue;
+        }
+        // the addresses are expected in 'mov r64, imm64' only (REX.W B8+r), an address anywhere else (a data table,
+        // a 32-bit displacement) can't be told from the data reliably and makes the code not cacheable
+        const bool movImm64 = pos >= 2 && (code[pos - 2] & 0xF8) == 0x48 && (code[pos - 1] & 0xF8) == 0xB8;
+        if (!movImm64)
+            return false;
+        if (inCode) {
+            image.relocations.push_back({pos, SELF, value - begin});
+        } else {
+            Dl_info info;
+            if (!dladdr(reinterpret_cast<void*>(value), &info) || !info.dli_fname || !info.dli_fbase)
+                return false;  // heap or anonymous memory
+            const auto name = baseName(info.dli_fname);
+            auto it = moduleIds.find(name);
+            if (it == moduleIds.end()) {
+                it = moduleIds.emplace(name, static_cast<int32_t>(image.modules.size())).first;
+                image.modules.push_back(name);
+            }
+            image.relocations.push_back({pos, it->second, value - reinterpret_cast<uint64_t>(info.dli_fbase)});
+        }
+        std::memset(image.code.data() + pos, 0, sizeof(uint64_t));
+        pos += sizeof(uint64_t);
+    }
+    return checkRelocations(image);
+#else
+    (void)code;
+    (void)size;
+    (void)image;
+    return false;
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
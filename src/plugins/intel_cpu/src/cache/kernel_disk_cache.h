@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Persistent cache of the generated JIT code
+ *
+ * The machine code of the kernels is kept in a directory, so the next processes load it instead of generating.
+ * The code is stored as an image which does not depend on the address space of the process: the absolute addresses
+ * inside the code and the addresses inside the loaded libraries (static tables, functions) are replaced by relocations.
+ * The code holding any other address (e.g. heap pointers) can't be reused and is not stored.
+ * Each file is validated with the checksum and the full key (kernel key, CPU and OpenVINO build), the total size of
+ * the directory is limited by removing the least recently used files. The code is mapped executable, so the directory
+ * and the files have to be owned by the user and not writable by the others: the cache is disabled or the file is
+ * skipped otherwise.
+ * A relative call or jump (rel32) to the code outside the kernel can't be found in the image, so the kernels using the
+ * cache must not emit them. The tests store every such kernel from two addresses and compare the images.
+ *
+ * Is a thread safe
+ */
+class KernelDiskCache {
+public:
+    typedef std::shared_ptr<KernelDiskCache> Ptr;
+
+    static constexpr int32_t SELF = -1;
+
+    struct Relocation {
+        uint64_t offset;  // position of the 64-bit address in the code
+        int32_t module;   // index in Image::modules or SELF for the addresses inside the code
+        uint64_t target;  // offset from the code start or from the module base
+    };
+
+    struct Image {
+        std::vector<uint8_t> code;  // the relocated addresses are zeroed
+        std::vector<Relocation> relocations;
+        std::vector<std::string> modules;
+        std::vector<uint64_t> moduleBases;  // resolved by load()
+        std::string metadata;               // kernel owner data, e.g. the snippet schedule
+    };
+
+    /**
+     * @brief Returns the cache shared by all the compiled models using the directory
+     * @return nullptr if the directory is empty, not trusted or the cache is not supported on the platform
+     */
+    static Ptr get(const std::string& dir, uint64_t sizeLimit);
+
+    /**
+     * @brief Loads the image of the kernel and resolves its relocations for the current process
+     */
+    bool load(const std::string& key, Image& image);
+
+    void store(const std::string& key, const Image& image);
+
+    /**
+     * @brief Makes the address independent image of the generated code
+     * @return false if the code depends on the address space of the process and can't be cached
+     */
+    static bool makeImage(const uint8_t* code, size_t size, Image& image);
+
+    size_t getHitsCount() const { return hitsCount.load(std::memory_order_relaxed); }
+    size_t getMissesCount() const { return missesCount.load(std::memory_order_relaxed); }
+
+    KernelDiskCache(std::string dir, uint64_t sizeLimit);
+
+private:
+    std::string fullKey(const std::string& key) const;
+    std::string filePath(const std::string& fullKey) const;
+    void evict();
+
+    const std::string dir;
+    const uint64_t sizeLimit;
+    std::mutex guard;
+    std::atomic<size_t> hitsCount {0};
+    std::atomic<size_t> missesCount {0};
+    std::atomic<size_t> tmpCounter {0};
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
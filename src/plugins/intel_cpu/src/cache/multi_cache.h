@@ -7,6 +7,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,7 +16,8 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note getOrCreate() may be called concurrently: the entries lookup and every entry storage access are serialized,
+ *       the value builders are not.
  */
 
 class MultiCache {
@@ -33,6 +35,12 @@ public:
     */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    // the copy shares the entries with the original cache, same as a member-wise copy would do
+    MultiCache(const MultiCache& other) : _capacity(other._capacity) {
+        std::lock_guard<std::mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
+
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
     *       using the key and the builder functor and adds the new record to the cache
@@ -59,6 +67,7 @@ private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    mutable std::mutex _storageMutex;
 };
 
 template<typename T>
@@ -71,6 +80,7 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -17,6 +17,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "utils/debug_capabilities.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
@@ -129,6 +130,60 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             } else {
                 fcSparseWeiDecompressionRate = val_f;
             }
+        } else if (key == ov::intel_cpu::share_weights_across_models.name()) {
+            if (val == PluginConfigParams::YES) {
+                shareWeightsAcrossModels = true;
+            } else if (val == PluginConfigParams::NO) {
+                shareWeightsAcrossModels = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::share_weights_across_models.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::streams_auto_tune.name()) {
+            if (val == PluginConfigParams::YES) {
+                streamsAutoTune = true;
+            } else if (val == PluginConfigParams::NO) {
+                streamsAutoTune = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::streams_auto_tune.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::elastic_streams.name()) {
+            if (val == PluginConfigParams::YES) {
+                elasticStreams = true;
+            } else if (val == PluginConfigParams::NO) {
+                elasticStreams = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::elastic_streams.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::dynamic_quantization.name()) {
+            if (val == PluginConfigParams::YES) {
+                fcDynamicQuantization = true;
+            } else if (val == PluginConfigParams::NO) {
+                fcDynamicQuantization = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::dynamic_quantization.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::layout_optimization.name()) {
+            if (val == PluginConfigParams::YES) {
+                layoutOptimization = true;
+            } else if (val == PluginConfigParams::NO) {
+                layoutOptimization = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::layout_optimization.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::kernel_cache_dir.name()) {
+            kernelCacheDir = val;
+        } else if (key == ov::intel_cpu::kernel_cache_size.name()) {
+            try {
+                kernelCacheSize = std::stoull(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::kernel_cache_size.name()
+                           << ". Expected only unsigned integer numbers";
+            }
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -51,6 +51,13 @@ struct Config {
     std::string dumpToDot = {};
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
+    bool shareWeightsAcrossModels = false;
+    bool streamsAutoTune = false;
+    bool elasticStreams = false;
+    bool fcDynamicQuantization = false;
+    bool layoutOptimization = false;
+    std::string kernelCacheDir = {};
+    uint64_t kernelCacheSize = 256ul * 1024 * 1024;
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
 #else
@@ -90,8 +97,15 @@ struct Config {
 
     bool isLegacyApi = false;
 
+    // Constant weights are views of a mapped compiled model blob, see Engine::ImportNetwork
+    bool mappedWeights = false;
+
     int modelPreferThreads = -1;
 
+    // The compiled model is a streams auto-tuning trial, see Engine::AutoTuneStreams. Its streams executor is not
+    // kept for reuse by the executor manager.
+    bool streamsTuneTrial = false;
+
 #ifdef CPU_DEBUG_CAPS
     DebugCapsConfig debugCaps;
     void applyDebugCapsProperties();
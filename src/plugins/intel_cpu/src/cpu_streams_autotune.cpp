@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_streams_autotune.hpp"
+
+#include <algorithm>
+
+#include "openvino/runtime/system_conf.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov {
+namespace intel_cpu {
+
+// a candidate replaces the current best one only when it is faster by this ratio
+static constexpr double significant_speedup = 1.03;
+
+std::vector<int> get_streams_tune_threads_per_stream(const int model_prefer_threads,
+                                                     const std::vector<std::vector<int>>& proc_type_table) {
+    std::vector<int> candidates = {model_prefer_threads};
+    // a stream is never spread across the sockets in the throughput mode
+    const auto& socket_procs = proc_type_table.size() > 1 ? proc_type_table[1] : proc_type_table[0];
+    const int max_threads = std::max(1, socket_procs[MAIN_CORE_PROC]);
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        if (std::find(candidates.begin(), candidates.end(), threads) == candidates.end()) {
+            candidates.push_back(threads);
+        }
+    }
+    return candidates;
+}
+
+StreamsTuneCandidate tune_streams(const int model_prefer_threads,
+                                  const bool cpu_pinning,
+                                  const bool tune_cpu_pinning,
+                                  const std::vector<std::vector<int>>& proc_type_table,
+                                  const StreamsTrialFunction& trial) {
+    StreamsTuneCandidate best = {model_prefer_threads, cpu_pinning};
+    double best_fps = trial(best);
+    DEBUG_LOG("Streams auto-tune: ", best.threads_per_stream, " threads per stream, pinning ", best.cpu_pinning, ": ",
+              best_fps, " FPS (heuristic)");
+
+    auto probe = [&](const StreamsTuneCandidate& candidate) {
+        const double fps = trial(candidate);
+        DEBUG_LOG("Streams auto-tune: ", candidate.threads_per_stream, " threads per stream, pinning ",
+                  candidate.cpu_pinning, ": ", fps, " FPS");
+        if (fps > best_fps * significant_speedup) {
+            best = candidate;
+            best_fps = fps;
+        }
+    };
+
+    // the threads per stream affect the performance most, so the pinning is only probed for the best of them
+    const auto threads_per_stream = get_streams_tune_threads_per_stream(model_prefer_threads, proc_type_table);
+    for (auto threads = std::next(threads_per_stream.begin()); threads != threads_per_stream.end(); ++threads) {
+        probe({*threads, cpu_pinning});
+    }
+    if (tune_cpu_pinning) {
+        probe({best.threads_per_stream, !cpu_pinning});
+    }
+
+    return best;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
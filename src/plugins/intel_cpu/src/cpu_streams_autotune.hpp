@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the empirical tuning of the streams layout
+ * @file cpu_streams_autotune.hpp
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Streams layout probed by a tuning trial
+ */
+struct StreamsTuneCandidate {
+    int threads_per_stream;  // model prefer threads, 0 means the default layout of get_streams_info_table()
+    bool cpu_pinning;
+};
+
+/**
+ * @brief      Generate the threads per stream values to be probed for the throughput mode
+ * @param[in]  model_prefer_threads value selected by the heuristic, it is always probed first
+ * @param[in]  proc_type_table candidate processors available at this time
+ * @return     threads per stream values: the heuristic one followed by the powers of two up to the number of the
+ *             main cores of a socket
+ */
+std::vector<int> get_streams_tune_threads_per_stream(const int model_prefer_threads,
+                                                     const std::vector<std::vector<int>>& proc_type_table);
+
+/**
+ * @brief Runs the trial of the candidate layout and returns the achieved throughput (inferences per second)
+ */
+using StreamsTrialFunction = std::function<double(const StreamsTuneCandidate&)>;
+
+/**
+ * @brief      Select the fastest streams layout by the timed trials
+ * @param[in]  model_prefer_threads value selected by the heuristic
+ * @param[in]  cpu_pinning pinning selected by the heuristic or by the user
+ * @param[in]  tune_cpu_pinning whether the pinning may be changed, i.e. it is not set explicitly
+ * @param[in]  proc_type_table candidate processors available at this time
+ * @param[in]  trial function running the trial of a candidate
+ * @return     the fastest candidate. The heuristic layout is kept unless another one is noticeably faster, so the
+ *             measurement noise does not flip the choice
+ */
+StreamsTuneCandidate tune_streams(const int model_prefer_threads,
+                                  const bool cpu_pinning,
+                                  const bool tune_cpu_pinning,
+                                  const std::vector<std::vector<int>>& proc_type_table,
+                                  const StreamsTrialFunction& trial);
+
+}  // namespace intel_cpu
+}  // namespace ov
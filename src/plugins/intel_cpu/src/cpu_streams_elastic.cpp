@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_streams_elastic.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace intel_cpu {
+
+ElasticStreamsSelector::ElasticStreamsSelector(const int compiled_streams, const int elastic_streams)
+    : _wide_layout(compiled_streams < elastic_streams ? 0 : 1),
+      _wide_streams(std::max(1, std::min(compiled_streams, elastic_streams))) {}
+
+int ElasticStreamsSelector::acquire() {
+    const int pending = ++_pending_requests;
+    // the wide streams are enough while every pending request gets its own stream
+    const int desired_layout = pending > _wide_streams ? 1 - _wide_layout : _wide_layout;
+
+    int active_layout = _active_layout;
+    if (desired_layout == active_layout) {
+        _switch_votes = 0;
+    } else if (++_switch_votes >= votes_to_switch) {
+        _switch_votes = 0;
+        _active_layout = desired_layout;
+        active_layout = desired_layout;
+    }
+    return active_layout;
+}
+
+void ElasticStreamsSelector::release() {
+    --_pending_requests;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
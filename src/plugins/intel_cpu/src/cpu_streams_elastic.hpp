@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the selection of the elastic streams layout
+ * @file cpu_streams_elastic.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Selects the streams layout the asynchronous requests are dispatched to, see ov::intel_cpu::elastic_streams.
+ * The layout of index 0 is the compiled one, the layout of index 1 is the alternative one.
+ * The wide layout (fewer streams) is used while every pending request gets its own stream, the narrow one otherwise.
+ * The active layout is switched when the load persistently calls for the other one, so the occasional bursts do not
+ * make the requests bounce between the layouts.
+ *
+ * Is a thread safe
+ */
+class ElasticStreamsSelector {
+public:
+    // number of the consecutive requests calling for the other layout to switch to it
+    static constexpr int votes_to_switch = 8;
+
+    /**
+     * @param compiled_streams number of the streams of the compiled layout
+     * @param elastic_streams number of the streams of the alternative layout
+     */
+    ElasticStreamsSelector(const int compiled_streams, const int elastic_streams);
+
+    /**
+     * @brief Registers the pending request and selects the layout to run it on
+     * @return index of the layout
+     */
+    int acquire();
+
+    /**
+     * @brief Unregisters the pending request when its inference is finished
+     */
+    void release();
+
+    int get_active_layout() const {
+        return _active_layout;
+    }
+
+private:
+    int _wide_layout;
+    int _wide_streams;
+    std::atomic_int _active_layout = {0};
+    std::atomic_int _pending_requests = {0};
+    std::atomic_int _switch_votes = {0};
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
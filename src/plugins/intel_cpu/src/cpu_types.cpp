@@ -203,7 +203,9 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "Interaction", Type::Interaction},
         { "MHA", Type::MHA},
         { "Unique", Type::Unique},
-        { "Ngram", Type::Ngram}
+        { "Ngram", Type::Ngram},
+        { "TokenSampling", Type::TokenSampling},
+        { "ImagePreprocess", Type::ImagePreprocess}
 };
 
 Type TypeFromName(const std::string& type) {
@@ -313,6 +315,8 @@ std::string NameFromType(const Type type) {
         CASE(MHA);
         CASE(Unique);
         CASE(Ngram);
+        CASE(TokenSampling);
+        CASE(ImagePreprocess);
         CASE(Unknown);
     }
 #undef CASE
@@ -111,7 +111,9 @@ enum class Type {
     Interaction,
     MHA,
     Unique,
-    Ngram
+    Ngram,
+    TokenSampling,
+    ImagePreprocess
 };
 
 enum class Algorithm {
@@ -169,6 +169,10 @@ ov::snippets::code ov::intel_cpu::CPUTargetMachine::get_snippet() const {
     return h->jit_ker();
 }
 
+size_t ov::intel_cpu::CPUTargetMachine::get_snippet_size() const {
+    return h->getSize();
+}
+
 ov::intel_cpu::CPUGenerator::CPUGenerator(dnnl::impl::cpu::x64::cpu_isa_t isa_) : Generator(std::make_shared<CPUTargetMachine>(isa_)) {
 }
 
@@ -20,6 +20,8 @@ public:
     bool is_supported() const override;
     snippets::code get_snippet() const override;
     size_t get_lanes() const override;
+    // size in bytes of the code returned by get_snippet()
+    size_t get_snippet_size() const;
 
 private:
     std::unique_ptr<dnnl::impl::cpu::x64::jit_generator> h;
@@ -15,6 +15,7 @@
 #include "serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
+#include "utils/bfloat16.hpp"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -31,6 +32,8 @@
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
+#include <condition_variable>
+#include <random>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -55,6 +58,8 @@ ExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs
     return std::make_shared<LegacyInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<ExecNetwork>(shared_from_this()));
 }
 
+const char ExecNetwork::streamsTuneExecutorName[] = "CPUStreamsTuneExecutor";
+
 struct ImmediateSerialExecutor : public ITaskExecutor {
     void run(InferenceEngine::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -95,7 +100,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 ? _cfg.streamExecutorConfig
                 : InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig,
                                                                                       isFloatModel);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        streamsExecutorConfig._name = _cfg.streamsTuneTrial ? streamsTuneExecutorName : "CPUStreamsExecutor";
         _cfg.streamExecutorConfig._threads = streamsExecutorConfig._threads;
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
@@ -114,26 +119,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
-    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
-    std::vector<Task> tasks; tasks.resize(streams);
-    _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
-        auto all_graphs_ready = [&] {
-            return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
-                return graph.IsReady();
-            });
-        };
-        do {
-            for (auto&& task : tasks) {
-                task = [this] {
-                    ExecNetwork::GetGraph();
-                };
-            }
-            _taskExecutor->runAndWait(tasks);
-        } while (!all_graphs_ready());
-    } else {
-        ExecNetwork::GetGraph();
-    }
+    CreateGraphs(0);
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -159,15 +145,42 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
-ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
+void ExecNetwork::CreateGraphs(int layout) {
+    const auto& cfg = layout == 0 ? _cfg : _elasticCfg;
+    auto& graphs = layout == 0 ? _graphs : _elasticGraphs;
+    int streams = std::max(1, cfg.streamExecutorConfig._streams);
+    std::vector<Task> tasks; tasks.resize(streams);
+    graphs.resize(streams);
+    if (cfg.streamExecutorConfig._streams != 0) {
+        auto all_graphs_ready = [&] {
+            return std::all_of(graphs.begin(), graphs.end(), [&] (Graph& graph) {
+                return graph.IsReady();
+            });
+        };
+        do {
+            for (auto&& task : tasks) {
+                task = [this, layout] {
+                    ExecNetwork::GetGraph(layout);
+                };
+            }
+            GetTaskExecutor(layout)->runAndWait(tasks);
+        } while (!all_graphs_ready());
+    } else {
+        ExecNetwork::GetGraph(layout);
+    }
+}
+
+ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph(int layout) const {
     int streamId = 0;
     int socketId = 0;
-    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    const auto& cfg = layout == 0 ? _cfg : _elasticCfg;
+    auto& graphs = layout == 0 ? _graphs : _elasticGraphs;
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(GetTaskExecutor(layout).get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         socketId = streamsExecutor->GetSocketId();
     }
-    auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
+    auto graphLock = GraphGuard::Lock(graphs[streamId % graphs.size()]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -175,16 +188,19 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                 GraphContext::Ptr ctx;
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
-                    // disable weights caching if graph was created only once
+                    // disable weights caching if graph was created only once, the elastic streams layouts share
+                    // the weights anyway
                     // "socketId != -1" is the WA for MacOS, will remove later
                     auto weightsCache =
-                        (_cfg.streamExecutorConfig._streams != 1 && socketId != -1) ? _socketWeights[socketId] : nullptr;
+                        ((cfg.streamExecutorConfig._streams != 1 || cfg.elasticStreams) && socketId != -1)
+                            ? _socketWeights[socketId]
+                            : nullptr;
 
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(cfg, extensionManager, weightsCache, isQuantizedFlag, socketId);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -203,6 +219,124 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     return graphLock;
 }
 
+void ExecNetwork::EnableElasticStreams(const Config& cfg) {
+    if (_cfg.exclusiveAsyncRequests || !memoryStates.empty() ||
+        cfg.streamExecutorConfig._streams == _cfg.streamExecutorConfig._streams)
+        return;
+
+    _elasticCfg = cfg;
+    _elasticCfg.isLegacyApi = _cfg.isLegacyApi;
+    auto streamsExecutorConfig = _elasticCfg.streamExecutorConfig;
+    streamsExecutorConfig._name = "CPUElasticStreamsExecutor";
+    _elasticTaskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+    _elasticCfg.streamExecutorConfig._threads = streamsExecutorConfig._threads;
+    _elasticSelector.reset(new ElasticStreamsSelector(_cfg.streamExecutorConfig._streams,
+                                                      _elasticCfg.streamExecutorConfig._streams));
+    // the graphs are created before the first request, so a layout switch under the changing load does not stall
+    // the requests dispatched to the new layout. The nodes are compiled for the threads of the layout streams (the
+    // per-thread buffers, the oneDNN primitives), so only the constants and the repacked weights are shared with the
+    // compiled layout through the weights cache
+    CreateGraphs(1);
+}
+
+int ExecNetwork::AcquireStreamsLayout() {
+    return _elasticSelector->acquire();
+}
+
+void ExecNetwork::ReleaseStreamsLayout() {
+    _elasticSelector->release();
+}
+
+namespace {
+template <typename T, typename Distribution>
+void fillRandom(const MemoryPtr& memory, Distribution distribution, std::mt19937& generator) {
+    auto* data = static_cast<T*>(memory->getData());
+    const size_t count = memory->getSize() / sizeof(T);
+    for (size_t i = 0; i < count; i++)
+        data[i] = static_cast<T>(distribution(generator));
+}
+}  // namespace
+
+double ExecNetwork::MeasureThroughput(std::chrono::milliseconds duration) const {
+    std::atomic<size_t> inferences{0};
+    std::chrono::steady_clock::time_point deadline;
+    // random non-zero inputs: the timings on zeros may benefit from the zero skipping kernels and cached results
+    auto fillInput = [](const MemoryPtr& memory) {
+        std::mt19937 generator(42);
+        switch (memory->getDesc().getPrecision()) {
+        case Precision::FP32:
+            fillRandom<float>(memory, std::uniform_real_distribution<float>(-1.f, 1.f), generator);
+            break;
+        case Precision::BF16:
+            fillRandom<bfloat16_t>(memory, std::uniform_real_distribution<float>(-1.f, 1.f), generator);
+            break;
+        case Precision::I32:
+            fillRandom<int32_t>(memory, std::uniform_int_distribution<int32_t>(1, 3), generator);
+            break;
+        case Precision::I8:
+            fillRandom<int8_t>(memory, std::uniform_int_distribution<int32_t>(1, 3), generator);
+            break;
+        case Precision::U8:
+            fillRandom<uint8_t>(memory, std::uniform_int_distribution<int32_t>(1, 3), generator);
+            break;
+        default:
+            std::memset(memory->getData(), 1, memory->getSize());
+        }
+    };
+    auto runInferences = [&](bool count) {
+        auto graphLock = GetGraph();
+        auto& graph = graphLock._graph;
+        if (graph.getStatus() != Graph::Status::ReadyStatic)
+            IE_THROW() << "Throughput can be measured for the model with static shapes only";
+        if (!count) {
+            for (auto& input : graph.GetInputNodesMap()) {
+                if (input.second->getChildEdges().empty())
+                    continue;
+                fillInput(input.second->getChildEdgeAt(0)->getMemoryPtr());
+            }
+        }
+        do {
+            graph.Infer();
+            if (count)
+                inferences++;
+        } while (count && std::chrono::steady_clock::now() < deadline);
+    };
+    auto runOnAllStreams = [&](bool count) {
+        const int streams = _cfg.streamExecutorConfig._streams;
+        if (streams == 0) {
+            runInferences(count);
+            return;
+        }
+        // each task holds its stream until all the tasks are started, so every stream runs exactly one of them
+        std::mutex mutex;
+        std::condition_variable allStarted;
+        int started = 0;
+        std::vector<Task> tasks(streams, [&] {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (++started == streams) {
+                    allStarted.notify_all();
+                } else {
+                    allStarted.wait(lock, [&] {
+                        return started == streams;
+                    });
+                }
+            }
+            runInferences(count);
+        });
+        _taskExecutor->runAndWait(tasks);
+    };
+
+    // the first inference of each stream warms up the caches and the lazily initialized kernels
+    runOnAllStreams(false);
+    const auto start = std::chrono::steady_clock::now();
+    deadline = start + duration;
+    runOnAllStreams(true);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return inferences / elapsed.count();
+}
+
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
 }
@@ -303,6 +437,14 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::compile_stage_timings.name()),
+            RO_property(ov::intel_cpu::fusion_statistics.name()),
+            RO_property(ov::intel_cpu::reorder_statistics.name()),
+            RO_property(ov::intel_cpu::elastic_streams.name()),
+            RO_property(ov::intel_cpu::dynamic_quantization.name()),
+            RO_property(ov::intel_cpu::kernel_cache_dir.name()),
+            RO_property(ov::intel_cpu::kernel_cache_size.name()),
+            RO_property(ov::intel_cpu::layout_optimization.name()),
         };
     }
 
@@ -311,7 +453,10 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         const std::string modelName = graph.dump()->get_friendly_name();
         return decltype(ov::model_name)::value_type(modelName);
     } else if (name == ov::optimal_number_of_infer_requests) {
-        const auto streams = config.streamExecutorConfig._streams;
+        // enough requests to keep the narrow streams of the elastic layouts busy
+        const auto streams = IsElastic()
+                                 ? std::max(config.streamExecutorConfig._streams, _elasticCfg.streamExecutorConfig._streams)
+                                 : config.streamExecutorConfig._streams;
         return decltype(ov::optimal_number_of_infer_requests)::value_type(streams); // ov::optimal_number_of_infer_requests has no negative values
     } else if (name == ov::num_streams) {
         const auto streams = config.streamExecutorConfig._streams;
@@ -360,6 +505,22 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::compile_stage_timings) {
+        return decltype(ov::intel_cpu::compile_stage_timings)::value_type(graph.getCompileStageTimings());
+    } else if (name == ov::intel_cpu::fusion_statistics) {
+        return decltype(ov::intel_cpu::fusion_statistics)::value_type(graph.getFusionStatistics());
+    } else if (name == ov::intel_cpu::reorder_statistics) {
+        return decltype(ov::intel_cpu::reorder_statistics)::value_type(graph.getReorderStatistics());
+    } else if (name == ov::intel_cpu::elastic_streams) {
+        return decltype(ov::intel_cpu::elastic_streams)::value_type(IsElastic());
+    } else if (name == ov::intel_cpu::dynamic_quantization) {
+        return decltype(ov::intel_cpu::dynamic_quantization)::value_type(config.fcDynamicQuantization);
+    } else if (name == ov::intel_cpu::kernel_cache_dir) {
+        return decltype(ov::intel_cpu::kernel_cache_dir)::value_type(config.kernelCacheDir);
+    } else if (name == ov::intel_cpu::kernel_cache_size) {
+        return decltype(ov::intel_cpu::kernel_cache_size)::value_type(config.kernelCacheSize);
+    } else if (name == ov::intel_cpu::layout_optimization) {
+        return decltype(ov::intel_cpu::layout_optimization)::value_type(config.layoutOptimization);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -10,8 +10,10 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
+#include "cpu_streams_elastic.hpp"
 #include <threading/ie_thread_local.hpp>
 
+#include <chrono>
 #include <vector>
 #include <memory>
 #include <map>
@@ -47,6 +49,42 @@ public:
 
     void Export(std::ostream& modelStream) override;
 
+    /**
+     * @brief Runs the inferences on all the streams with the synthetic (random) inputs for the given time
+     * @return achieved throughput in inferences per second
+     */
+    double MeasureThroughput(std::chrono::milliseconds duration) const;
+
+    // name of the streams executors of the auto-tuning trials, they are cleared from the executor manager after use
+    static const char streamsTuneExecutorName[];
+
+    /**
+     * @brief Prepares the alternative streams layout the asynchronous requests are switched to under the changing load,
+     * see ov::intel_cpu::elastic_streams. Has no effect if the layout does not differ from the compiled one or the model
+     * is stateful.
+     * @param cfg configuration with the streams of the alternative layout
+     */
+    void EnableElasticStreams(const Config& cfg);
+
+    bool IsElastic() const {
+        return _elasticTaskExecutor != nullptr;
+    }
+
+    /**
+     * @brief Registers the pending asynchronous request and selects the streams layout to run it on
+     * @return index of the layout for GetTaskExecutor() and GetGraph()
+     */
+    int AcquireStreamsLayout();
+
+    /**
+     * @brief Unregisters the pending asynchronous request when its inference is finished
+     */
+    void ReleaseStreamsLayout();
+
+    const InferenceEngine::ITaskExecutor::Ptr& GetTaskExecutor(int layout) const {
+        return layout == 0 ? _taskExecutor : _elasticTaskExecutor;
+    }
+
 protected:
     friend class InferRequestBase;
     ExtensionManager::Ptr extensionManager;
@@ -70,11 +108,21 @@ protected:
     mutable std::deque<GraphGuard>              _graphs;
     mutable SocketsWeights                      _socketWeights;
 
+    // The alternative streams layout (index 1) of the elastic streams, the compiled one has index 0.
+    // Its graphs are created along with the compiled ones on their own streams and share the weights with them.
+    Config                                      _elasticCfg;
+    InferenceEngine::ITaskExecutor::Ptr         _elasticTaskExecutor;
+    mutable std::deque<GraphGuard>              _elasticGraphs;
+    std::unique_ptr<ElasticStreamsSelector>     _elasticSelector;
+
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
-    GraphGuard::Lock GetGraph() const;
+    GraphGuard::Lock GetGraph(int layout = 0) const;
+
+    // Creates the graphs of all the streams of the layout, each of them on its own stream
+    void CreateGraphs(int layout);
 
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
@@ -8,6 +8,8 @@
 #include "transformations/cpu_opset/common/op/power_static.hpp"
 #include "transformations/cpu_opset/common/op/swish_cpu.hpp"
 #include "transformations/cpu_opset/common/op/ngram.hpp"
+#include "transformations/cpu_opset/common/op/token_sampling.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
 #include "transformations/cpu_opset/x64/op/mha.hpp"
 #include "transformations/cpu_opset/x64/op/interaction.hpp"
 #include "transformations/snippets/x64/op/load_convert.hpp"
@@ -58,6 +60,8 @@ std::map<std::string, ngraph::OpSet> Extension::getOpSets() {
         NGRAPH_OP(PowerStaticNode, ov::intel_cpu)
         NGRAPH_OP(SwishNode, ov::intel_cpu)
         NGRAPH_OP(NgramNode, ov::intel_cpu)
+        NGRAPH_OP(TokenSamplingNode, ov::intel_cpu)
+        NGRAPH_OP(ImagePreprocessNode, ov::intel_cpu)
         NGRAPH_OP_X64(MHANode, ov::intel_cpu)
         NGRAPH_OP_X64(InteractionNode, ov::intel_cpu)
 #undef NGRAPH_OP
@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <chrono>
+#include <functional>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -346,29 +348,57 @@ void Graph::Replicate(const CNNNetwork &network) {
 
 void Graph::InitGraph() {
     GraphOptimizer optimizer;
+    compileStageTimings.clear();
 
-    SortTopologically();
-    InitNodes();
-
-    optimizer.ApplyCommonGraphOptimizations(*this);
-    SortTopologically();
-
-    InitDescriptors();
-
-    ResolveInplaceDirections();
-
-    InitOptimalPrimitiveDescriptors();
-
-    InitEdges();
-
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
-    SortTopologically();
-
-    const bool hasDynNodes = ProcessDynNodes();
-
-    Allocate();
+    auto timed = [this](const char* stage, const std::function<void()>& body) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        compileStageTimings[stage] += elapsed.count();
+    };
 
-    CreatePrimitivesAndExecConstants();
+    timed("InitNodes", [&] {
+        SortTopologically();
+        InitNodes();
+    });
+
+    timed("CommonGraphOptimizations", [&] {
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+    });
+    CollectFusionStatistics();
+
+    timed("InitDescriptors", [&] {
+        InitDescriptors();
+    });
+
+    timed("OptimizeLayouts", [&] {
+        OptimizeLayouts();
+    });
+
+    timed("SelectDescriptors", [&] {
+        ResolveInplaceDirections();
+        InitOptimalPrimitiveDescriptors();
+    });
+
+    timed("InitEdges", [&] {
+        InitEdges();
+    });
+
+    timed("ImplSpecificGraphOptimizations", [&] {
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+        SortTopologically();
+    });
+
+    bool hasDynNodes = false;
+    timed("Allocate", [&] {
+        hasDynNodes = ProcessDynNodes();
+        Allocate();
+    });
+
+    timed("CreatePrimitives", [&] {
+        CreatePrimitivesAndExecConstants();
+    });
 
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
@@ -388,29 +418,61 @@ void Graph::InitNodes() {
     }
 }
 
+void Graph::CollectFusionStatistics() {
+    fusionStatistics.clear();
+    for (const auto& node : graphNodes) {
+        for (const auto& fusedNode : node->getFusedWith()) {
+            fusionStatistics["fused:" + NameFromType(node->getType()) + "+" + NameFromType(fusedNode->getType())]++;
+        }
+        // each standalone simple operation costs an extra pass over the memory
+        if (one_of(node->getType(), Type::Eltwise, Type::FakeQuantize) && !node->getParentEdges().empty()) {
+            const auto producer = node->getParentEdgeAt(0)->getParent();
+            fusionStatistics["unfused:" + NameFromType(producer->getType()) + "+" + NameFromType(node->getType())]++;
+        }
+    }
+}
+
 void Graph::InitDescriptors() {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "InitDescriptors", "Prepare");
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "InitDescriptors");
 
-    for (auto &node : graphNodes) {
+    // The descriptors enumeration of a node depends only on the node itself and on the graph topology,
+    // so the nodes are processed concurrently. The selection below stays sequential since it looks at the
+    // neighbours' choices and has to follow the topological order.
+    // Some nodes check the constness of their neighbours there, and Node::isConstant() lazily resolves it for the
+    // whole connected part of the graph, so it is resolved for all the nodes beforehand.
+    for (auto& node : graphNodes) {
+        node->isConstant();
+    }
+
+    parallel_for(graphNodes.size(), [&](size_t i) {
+        const auto& node = graphNodes[i];
         if (node->getType() == Type::Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
             auto *inputNode = dynamic_cast<node::Input *>(node.get());
             if (inputNode)
                 inputNode->withMeanImage();
         }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        DEBUG_LOG("Get supported primitive descriptors for node: ", node->getName());
-        node->getSupportedDescriptors();
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.getSupportedDescriptors);
+            DEBUG_LOG("Get supported primitive descriptors for node: ", node->getName());
+            node->getSupportedDescriptors();
+        }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        DEBUG_LOG("Init supported primitive descriptors for node: ", node->getName());
-        node->initSupportedPrimitiveDescriptors();
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            DEBUG_LOG("Init supported primitive descriptors for node: ", node->getName());
+            node->initSupportedPrimitiveDescriptors();
+        }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        DEBUG_LOG("Filter supported primitive descriptors for node: ", node->getName());
-        node->filterSupportedPrimitiveDescriptors();
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+            DEBUG_LOG("Filter supported primitive descriptors for node: ", node->getName());
+            node->filterSupportedPrimitiveDescriptors();
+        }
+    });
 
 #ifdef CPU_DEBUG_CAPS
+    for (auto &node : graphNodes) {
         const auto& SPDs = node->getSupportedPrimitiveDescriptors();
         for (size_t i = 0; i < SPDs.size(); i++) {
             DEBUG_LOG("#",
@@ -424,16 +486,146 @@ void Graph::InitDescriptors() {
                       "]: \n",
                       SPDs[i]);
         }
-#endif
     }
+#endif
 
     for (auto &node : graphNodes) {
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.selectOptimalPrimitiveDescriptor);
         DEBUG_LOG("Select optimal primitive descriptors for node: ", node->getName());
         node->selectOptimalPrimitiveDescriptor();
     }
 }
 
+// The bytes read and written by a reorder between the two descriptors. The dynamic dimensions are estimated by their
+// upper bounds, or by the lower bounds when the upper ones are not defined.
+static uint64_t reorderBytes(const MemoryDesc& srcDesc, const MemoryDesc& dstDesc) {
+    const auto& shape = dstDesc.getShape();
+    const auto& dims = shape.isStatic() ? shape.getStaticDims() : shape.getMaxDims();
+    uint64_t elements = 1;
+    for (size_t i = 0; i < dims.size(); i++) {
+        elements *= dims[i] == Shape::UNDEFINED_DIM ? std::max<size_t>(shape.getMinDims()[i], 1) : dims[i];
+    }
+    return elements * (srcDesc.getPrecision().size() + dstDesc.getPrecision().size());
+}
+
+// The cost of the reorder the edge needs with the given descriptors of its ends, zero when no reorder is needed.
+// The reorders of the constant inputs are executed once on the network loading, so they are free.
+static uint64_t edgeReorderCost(const EdgePtr& edge, const NodeDesc& parentPd, const NodeDesc& childPd) {
+    const auto& outConfs = parentPd.getConfig().outConfs;
+    const auto& inConfs = childPd.getConfig().inConfs;
+    const int childPort = edge->getOutputNum();
+    if (edge->getParent()->isConstant() || outConfs.empty() ||
+        childPort < 0 || childPort >= static_cast<int>(inConfs.size()))
+        return 0;
+
+    int parentPort = edge->getInputNum();
+    if (parentPort < 0 || parentPort >= static_cast<int>(outConfs.size()))
+        parentPort = 0;
+
+    const auto& srcDesc = outConfs[parentPort].getMemDesc();
+    const auto& dstDesc = inConfs[childPort].getMemDesc();
+    return dstDesc->isCompatible(*srcDesc) ? 0 : reorderBytes(*srcDesc, *dstDesc);
+}
+
+void Graph::OptimizeLayouts() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::OptimizeLayouts");
+
+    auto accumulate = [this](const char* stage) {
+        uint64_t count = 0, bytes = 0;
+        for (const auto& edge : graphEdges) {
+            const auto parentPd = edge->getParent()->getSelectedPrimitiveDescriptor();
+            const auto childPd = edge->getChild()->getSelectedPrimitiveDescriptor();
+            if (!parentPd || !childPd)
+                continue;
+            if (const auto cost = edgeReorderCost(edge, *parentPd, *childPd)) {
+                count++;
+                bytes += cost;
+            }
+        }
+        reorderStatistics[std::string(stage) + ":reorders"] = count;
+        reorderStatistics[std::string(stage) + ":bytes"] = bytes;
+        DEBUG_LOG(stage, " layouts: ", count, " reorders moving ", bytes, " bytes");
+    };
+
+    // The cost of the reorders around the node if it is switched to the descriptor, the neighbours keep their choices
+    auto nodeCost = [](const NodePtr& node, const NodeDesc& pd) {
+        uint64_t cost = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            if (const auto parentPd = edge->getParent()->getSelectedPrimitiveDescriptor())
+                cost += edgeReorderCost(edge, *parentPd, pd);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            if (const auto childPd = edge->getChild()->getSelectedPrimitiveDescriptor())
+                cost += edgeReorderCost(edge, pd, *childPd);
+        }
+        return cost;
+    };
+
+    // the in-place memory sharing is resolved later on, so the switch must not change it
+    auto sameInPlacePorts = [](const NodeDesc& lhs, const NodeDesc& rhs) {
+        auto samePorts = [](const std::vector<PortConfig>& lhsConfs, const std::vector<PortConfig>& rhsConfs) {
+            return lhsConfs.size() == rhsConfs.size() &&
+                   std::equal(lhsConfs.begin(), lhsConfs.end(), rhsConfs.begin(), [](const PortConfig& l, const PortConfig& r) {
+                       return l.inPlace() == r.inPlace();
+                   });
+        };
+        return samePorts(lhs.getConfig().inConfs, rhs.getConfig().inConfs) &&
+               samePorts(lhs.getConfig().outConfs, rhs.getConfig().outConfs);
+    };
+
+    reorderStatistics.clear();
+    accumulate("before");
+
+    // The greedy selection looks only at the parents, so a node picks the layout of its inputs even when all its
+    // consumers need another one. The descriptors are refined here by a local search over the whole graph: each node
+    // is switched to the descriptor of the same implementation type minimizing the bytes moved by the reorders on its
+    // edges. Every switch strictly decreases the total cost, so the sweeps converge; the ties keep the greedy choice.
+    // The nodes with the custom selection logic are left as they are. The statistics are reported even when the
+    // refinement is disabled, so both choices can be compared.
+    const size_t maxSweeps = getConfig().layoutOptimization ? 4 : 0;
+    for (size_t sweep = 0; sweep < maxSweeps; sweep++) {
+        bool changed = false;
+        for (const auto& node : graphNodes) {
+            if (one_of(node->getType(), Type::Input, Type::Output, Type::Concatenation, Type::Split, Type::Subgraph) ||
+                node->isConstant())
+                continue;
+
+            const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+            if (!selectedPd)
+                continue;
+
+            const auto& SPDs = node->getSupportedPrimitiveDescriptors();
+            int bestIdx = node->selectedPrimitiveDescriptorIndex;
+            uint64_t bestCost = nodeCost(node, *selectedPd);
+            for (size_t i = 0; i < SPDs.size() && bestCost > 0; i++) {
+                const auto& pd = SPDs[i];
+                if (static_cast<int>(i) == node->selectedPrimitiveDescriptorIndex ||
+                    pd.getImplementationType() != selectedPd->getImplementationType() ||
+                    !sameInPlacePorts(pd, *selectedPd))
+                    continue;
+
+                const auto cost = nodeCost(node, pd);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIdx = static_cast<int>(i);
+                }
+            }
+
+            if (bestIdx != node->selectedPrimitiveDescriptorIndex) {
+                DEBUG_LOG(node->getName(), " switch primitive desc: ", node->selectedPrimitiveDescriptorIndex, " -> ", bestIdx);
+                node->selectPrimitiveDescriptorByIndex(bestIdx);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+
+    accumulate("after");
+}
+
 void Graph::ResolveInplaceDirections() {
      OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::ResolveInplaceDirections");
 
@@ -500,17 +692,24 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
-    for (const auto &node : graphNodes) {
-        {
-            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
-            DEBUG_LOG(*node);
-            node->createPrimitive();
-        }
+    auto createPrimitive = [](const NodePtr& node) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
+        DEBUG_LOG(*node);
+        node->createPrimitive();
+    };
 
+    // Constant nodes are created and executed first in the topological order, so their outputs (e.g. weights) are
+    // ready before any consumer prepares its primitive.
+    std::vector<NodePtr> nonConstantNodes;
+    nonConstantNodes.reserve(graphNodes.size());
+    for (const auto &node : graphNodes) {
         if (!node->isConstant()) {
+            nonConstantNodes.push_back(node);
             continue;
         }
 
+        createPrimitive(node);
+
         if (context->getWeightsCache()) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
@@ -524,6 +723,12 @@ void Graph::CreatePrimitivesAndExecConstants() const {
             ExecuteNode(node, stream);
         }
     }
+
+    // The remaining primitives (and the JIT kernels behind them) only depend on the node's own configuration and
+    // memory, so they are created concurrently. The result does not depend on the creation order.
+    parallel_for(nonConstantNodes.size(), [&](size_t i) {
+        createPrimitive(nonConstantNodes[i]);
+    });
 }
 
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const dnnl::engine& eng) {
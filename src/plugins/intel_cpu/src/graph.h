@@ -194,6 +194,29 @@ public:
 
     Status getStatus() const {return status;}
 
+    /**
+     * @brief Wall time in milliseconds spent in each stage of the last graph compilation
+     */
+    const std::map<std::string, double>& getCompileStageTimings() const {
+        return compileStageTimings;
+    }
+
+    /**
+     * @brief Number of the operations fused into the other nodes ("fused:<host>+<operation>") and of the simple
+     * operations (Eltwise, FakeQuantize) left standalone ("unfused:<producer>+<operation>") in the graph
+     */
+    const std::map<std::string, uint64_t>& getFusionStatistics() const {
+        return fusionStatistics;
+    }
+
+    /**
+     * @brief Number of the reorders planned by the layouts selection and the bytes they move, before ("before:") and
+     * after ("after:") the layouts refinement
+     */
+    const std::map<std::string, uint64_t>& getReorderStatistics() const {
+        return reorderStatistics;
+    }
+
 protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
@@ -225,11 +248,17 @@ protected:
 
     bool graphHasDynamicInput = false;
 
+    std::map<std::string, double> compileStageTimings;
+    std::map<std::string, uint64_t> fusionStatistics;
+    std::map<std::string, uint64_t> reorderStatistics;
+
     void Replicate(const InferenceEngine::CNNNetwork &network);
     void Replicate(const std::shared_ptr<const ov::Model> &subgraph);
     void InitGraph();
     void InitNodes();
+    void CollectFusionStatistics();
     void InitDescriptors();
+    void OptimizeLayouts();
     void ResolveInplaceDirections();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "cache/kernel_disk_cache.h"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
@@ -21,13 +22,16 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 int socketId = 0)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
-          isGraphQuantizedFlag(isGraphQuantized) {
+          isGraphQuantizedFlag(isGraphQuantized),
+          socketId(socketId) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+        kernelCache = KernelDiskCache::get(config.kernelCacheDir, config.kernelCacheSize);
     }
 
     const Config& getConfig() const {
@@ -51,6 +55,10 @@ public:
         return rtScratchPad;
     }
 
+    KernelDiskCache::Ptr getKernelCache() const {
+        return kernelCache;
+    }
+
     dnnl::engine getEngine() const {
         return eng;
     }
@@ -59,6 +67,10 @@ public:
         return isGraphQuantizedFlag;
     }
 
+    int getSocketId() const {
+        return socketId;
+    }
+
 private:
     Config config;  // network-level config
 
@@ -67,8 +79,10 @@ private:
 
     MultiCachePtr rtParamsCache;     // primitive cache
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    KernelDiskCache::Ptr kernelCache;  // persistent JIT code cache, nullptr if disabled
 
     bool isGraphQuantizedFlag = false;
+    int socketId = 0;  // socket of the stream the graph is created on
     static dnnl::engine eng;  // onednn engine (singleton)
 };
 
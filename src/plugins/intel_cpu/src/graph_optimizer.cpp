@@ -139,28 +139,8 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseConvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
-    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFullyConnectedAndSimpleOperation");
-    FuseFullyConnectedAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMatMulAndSimpleOperation");
-    FuseMatMulAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMVNAndSimpleOperation");
-    FuseMVNAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInterpolateAndSimpleOperation");
-    FuseInterpolateAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseNormalizeL2AndSimpleOperation");
-    FuseNormalizeL2AndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseReduceAndSimpleOperation");
-    FuseReduceAndSimpleOperation(graph);
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseNodeAndSimpleOperations");
+    FuseNodeAndSimpleOperations(graph);
     graph.RemoveDroppedNodes();
 
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
@@ -981,76 +961,79 @@ void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph &graph) {
     }
 }
 
-void GraphOptimizer::FuseFullyConnectedAndSimpleOperation(Graph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSuitableParentNode = [](NodePtr node) {
-        return node->getType() == Type::FullyConnected && node->getChildEdges().size() == 1;
+void GraphOptimizer::FuseNodeAndSimpleOperations(Graph &graph) {
+    struct PostOpsHost {
+        Type type;
+        // the fused operation must not consume the inputs of the host
+        bool checkSharedInputs;
+    };
+    // The nodes accepting the chains of the simple operations (Eltwise, FakeQuantize) as post-ops, what exactly is
+    // accepted is declared by Node::canFuse(). The nodes with the specific fusing rules (e.g. Convolution sum) have
+    // their own passes.
+    static const std::vector<PostOpsHost> hosts = {
+        {Type::FullyConnected, false},
+        {Type::MatMul, false},
+        {Type::MVN, false},
+        {Type::Interpolate, true},
+        {Type::NormalizeL2, false},
+        {Type::Reduce, false},
     };
 
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSuitableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        CPU_GRAPH_OPTIMIZER_SCOPE(FuseFullyConnectedAndSimpleOperation_ParentNode);
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!parentNode->canFuse(childNode)) {
-            parent++;
-            continue;
-        }
-
-        childNode->fuseInto(parentNode);
+    auto& graphNodes = graph.GetNodes();
 
-        if (childNode->getType() == Type::FakeQuantize || childNode->getType() == Type::Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Type::FullyConnected)
-                    continue;
+    auto findHost = [](const NodePtr& node) -> const PostOpsHost* {
+        if (node->getChildEdges().size() != 1)
+            return nullptr;
+        const auto it = std::find_if(hosts.begin(), hosts.end(), [&](const PostOpsHost& candidate) {
+            return candidate.type == node->getType();
+        });
+        return it != hosts.end() ? &*it : nullptr;
+    };
 
-                graph.RemoveEdge(p_edge);
+    auto isSuitableChildNode = [](const PostOpsHost& host, const NodePtr& parentNode, const NodePtr& childNode) {
+        if (host.checkSharedInputs) {
+            for (auto &childParentEdge : childNode->getParentEdges()) {
+                for (auto &parentParentEdge : parentNode->getParentEdges()) {
+                    if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
+                        return false;
+                }
             }
         }
-
-        graph.DropNode(childNode);
-    }
-}
-
-void GraphOptimizer::FuseMatMulAndSimpleOperation(Graph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](const NodePtr& node) {
-        return node->getType() == Type::MatMul && node->getChildEdges().size() == 1;
+        // the operations fused into the child would be lost
+        if (!childNode->getFusedWith().empty())
+            return false;
+        return parentNode->canFuse(childNode);
     };
 
+    // the chain is attached greedily: the same parent is checked again with its new child
     auto parent = graphNodes.begin();
     while (parent != graphNodes.end()) {
         auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
+        const auto host = findHost(parentNode);
+        if (!host) {
             parent++;
             continue;
         }
 
-        CPU_GRAPH_OPTIMIZER_SCOPE(FuseMatMulAndSimpleOperation_ParentNode);
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseNodeAndSimpleOperations_ParentNode);
 
         auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!parentNode->canFuse(childNode)) {
+        if (!isSuitableChildNode(*host, parentNode, childNode)) {
             parent++;
             continue;
         }
 
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseNodeAndSimpleOperations_ChildNode);
+
         childNode->fuseInto(parentNode);
 
         if (childNode->getType() == Type::FakeQuantize || childNode->getType() == Type::Eltwise) {
             auto parentEdges = childNode->parentEdges;
             for (auto &parentEdge : parentEdges) {
                 auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Type::MatMul)
+                if (p_edge == nullptr)
+                    IE_THROW() << "Cannot get parent edge " << childNode->getName();
+                if (p_edge->getParent() == parentNode)
                     continue;
 
                 graph.RemoveEdge(p_edge);
@@ -1621,187 +1604,6 @@ void GraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(Graph &graph)
     }
 }
 
-void GraphOptimizer::FuseMVNAndSimpleOperation(Graph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSuitableParentNode = [](NodePtr node) {
-        return (node->getType() == Type::MVN) && (node->getChildEdges().size() == 1);
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSuitableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        CPU_GRAPH_OPTIMIZER_SCOPE(FuseMVNAndSimpleOperation_ParentNode);
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!parentNode->canFuse(childNode)) {
-            parent++;
-            continue;
-        }
-
-        childNode->fuseInto(parentNode);
-
-        if (childNode->getType() == Type::FakeQuantize || childNode->getType() == Type::Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Type::MVN)
-                    continue;
-
-                graph.RemoveEdge(p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
-}
-
-void GraphOptimizer::FuseInterpolateAndSimpleOperation(Graph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSuitableParentNode = [](NodePtr node) {
-        return node->getType() == Type::Interpolate && node->getChildEdges().size() == 1;
-    };
-
-    auto isSuitableChildNode = [&](NodePtr parentNode, NodePtr childNode) {
-        // Avoid cycle dependencies
-        for (auto &childParentEdge : childNode->getParentEdges()) {
-            for (auto &parentParentEdge : parentNode->getParentEdges()) {
-                if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
-                    return false;
-            }
-        }
-        if (!childNode->getFusedWith().empty())
-            return false;
-        auto interpolateNode = dynamic_cast<Interpolate*>(parentNode.get());
-        if (!interpolateNode) {
-            IE_THROW() << "Cannot cast " << parentNode->getName() << " to Interpolate";
-        }
-        return interpolateNode->canFuse(childNode);
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSuitableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        CPU_GRAPH_OPTIMIZER_SCOPE(FuseInterpolateAndSimpleOperation_ParentNode);
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSuitableChildNode(parentNode, childNode)) {
-            parent++;
-            continue;
-        }
-
-        CPU_GRAPH_OPTIMIZER_SCOPE(FuseInterpolateAndSimpleOperation_ChildNode);
-
-        childNode->fuseInto(parentNode);
-
-        if (childNode->getType() == Type::FakeQuantize || childNode->getType() == Type::Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Type::Interpolate)
-                    continue;
-
-                graph.RemoveEdge(p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
-}
-
-void GraphOptimizer::FuseNormalizeL2AndSimpleOperation(Graph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSuitableParentNode = [](NodePtr node) {
-        return node->getType() == Type::NormalizeL2 && node->getChildEdges().size() == 1;
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSuitableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        CPU_GRAPH_OPTIMIZER_SCOPE(FuseNormalizeL2AndSimpleOperation_ParentNode);
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!parentNode->canFuse(childNode)) {
-            parent++;
-            continue;
-        }
-
-        childNode->fuseInto(parentNode);
-
-        if (childNode->getType() == Type::FakeQuantize || childNode->getType() == Type::Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Type::NormalizeL2)
-                    continue;
-
-                graph.RemoveEdge(p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
-}
-
-void GraphOptimizer::FuseReduceAndSimpleOperation(Graph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSuitableParentNode = [](NodePtr node) {
-        return node->getType() == Type::Reduce && node->getChildEdges().size() == 1;
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSuitableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        CPU_GRAPH_OPTIMIZER_SCOPE(FuseReduceAndSimpleOperation_ParentNode);
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!parentNode->canFuse(childNode)) {
-            parent++;
-            continue;
-        }
-
-        childNode->fuseInto(parentNode);
-
-        if (childNode->getType() == Type::FakeQuantize || childNode->getType() == Type::Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge == nullptr)
-                    IE_THROW() << "Cannot get parent edge " << childNode->getName();
-                if (p_edge->getParent()->getType() == Type::Reduce)
-                    continue;
-
-                graph.RemoveEdge(p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
-}
-
 void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
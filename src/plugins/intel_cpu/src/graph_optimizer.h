@@ -27,17 +27,12 @@ private:
     void FuseMultiplyAndAdd(Graph &graph);
     void MergeConvertAndScaleShift(Graph& graph);
     void FuseFCAndConvertOnWeights(Graph& graph);
-    void FuseFullyConnectedAndSimpleOperation(Graph &graph);
-    void FuseMatMulAndSimpleOperation(Graph &graph);
+    void FuseNodeAndSimpleOperations(Graph &graph);
     void FuseConvolutionAndSimpleOperationThroughMaxPool(Graph &graph);
     void FuseConvolutionAndSimpleOperation(Graph &graph);
     void FuseConvolutionAndDWConvolution(Graph &graph);
     void FusePoolingAndFakeQuantize(Graph &graph);
     void FuseConvolutionSumAndConvolutionSumActivation(Graph &graph);
-    void FuseMVNAndSimpleOperation(Graph &graph);
-    void FuseInterpolateAndSimpleOperation(Graph &graph);
-    void FuseNormalizeL2AndSimpleOperation(Graph &graph);
-    void FuseReduceAndSimpleOperation(Graph &graph);
 
     void DropDoubleReorders(Graph& graph);
     void FuseConvolutionAndZeroPoints(Graph &graph);
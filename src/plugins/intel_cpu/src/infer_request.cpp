@@ -155,7 +155,7 @@ void InferRequestBase::redefineMemoryForInputNodes() {
 void InferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    auto graphLock = execNetwork->GetGraph(streamsLayout);
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
@@ -38,6 +38,13 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Sets the streams layout of the elastic streams the next inference runs on, see ExecNetwork::AcquireStreamsLayout
+     */
+    void SetStreamsLayout(int layout) {
+        streamsLayout = layout;
+    }
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -121,6 +128,7 @@ private:
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+    int                                 streamsLayout = 0;
 
 protected:
     virtual void changeDefaultPtr();
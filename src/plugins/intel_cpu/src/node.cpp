@@ -65,6 +65,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace dnnl;
 using namespace openvino;
@@ -129,6 +130,10 @@ Node::Node(const std::shared_ptr<ngraph::Node>& op,
 
     if (isDynamic) {
         shapeInference = shapeInferFactory.makeShapeInfer();
+        if (shapeInference->get_port_mask() == EMPTY_PORT_MASK) {
+            memoizedShapeInference = std::make_shared<MemoizedShapeInfer>(shapeInference, MemoizedShapeInfer::defaultCapacity);
+            shapeInference = memoizedShapeInference;
+        }
     }
 
     const auto& rtInfo = op->get_rt_info();
@@ -574,11 +579,30 @@ std::vector<memory::format_tag> Node::getAvailableFormatsForDims(const Shape &di
 
 void Node::updateShapes() {
     IE_ASSERT(isDynamicNode()) << "Node::updateShapes() is called to a static shape node of type: " << getTypeStr() << " with name: " << getName();
-    if (needShapeInfer()) {
-        auto result = shapeInfer();
-        if (ShapeInferStatus::success == result.status) {
-            redefineOutputMemory(result.dims);
+    if (!needShapeInfer())
+        return;
+
+    // nodes may replace shapeInference after construction, so the memoized path is taken only if it is still in use
+    if (memoizedShapeInference && memoizedShapeInference.get() == shapeInference.get()) {
+        shapeInferInputs.clear();
+        for (size_t port = 0; port < inputShapes.size(); ++port)
+            shapeInferInputs.emplace_back(std::cref(getParentEdgesAtPort(port)[0]->getMemory().getStaticDims()));
+
+        try {
+            const auto& entry = memoizedShapeInference->inferCached(shapeInferInputs);
+            if (ShapeInferStatus::success == entry.result.status) {
+                redefineOutputMemory(entry.result.dims);
+            }
+        }
+        catch (const std::runtime_error& exp) {
+            IE_THROW() << "Shape inference of " << getTypeStr()  << " node with name " << getName() << " failed: " << exp.what();
         }
+        return;
+    }
+
+    auto result = shapeInfer();
+    if (ShapeInferStatus::success == result.status) {
+        redefineOutputMemory(result.dims);
     }
 }
 
@@ -621,10 +645,8 @@ void Node::redefineOutputMemory(const std::vector<VectorDims> &newOutputShapes)
         const auto edges = getChildEdgesAtPort(i);
 
         // avoid 0D shape incompatible
-        auto newOutputShape = newOutputShapes[i];
-        if (newOutputShape.empty()) {
-            newOutputShape.push_back(1);
-        }
+        static const VectorDims singleElementShape{1};
+        const auto& newOutputShape = newOutputShapes[i].empty() ? singleElementShape : newOutputShapes[i];
 
         const auto &currDesc = edges[0]->getMemory().getDesc();
         if (currDesc.getShape().isStatic() && currDesc.getShape().getStaticDims() == newOutputShape)
@@ -827,7 +849,20 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
 
     MemoryPtr ptr;
     auto weightCache = context->getWeightsCache();
-    if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
+    if (context->getConfig().shareWeightsAcrossModels &&
+        memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
+        using dnnl::impl::primitive_hashing::get_md_hash;
+        const auto srcDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
+        const uint64_t data_hash =
+            GlobalWeightsStore::contentHash(internalBlob->buffer(), internalBlob->byteSize(), weightCache);
+
+        const std::string string_hash = std::to_string(get_md_hash(*srcDesc->getDnnlDesc().get()))
+                                        + "_" + std::to_string(get_md_hash(*intDesc->getDnnlDesc().get()))
+                                        + "_" + std::to_string(internalBlob->byteSize())
+                                        + "_" + std::to_string(data_hash);
+
+        ptr = GlobalWeightsStore::instance()->findOrCreate(string_hash, context->getSocketId(), create);
+    } else if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
         const auto& format = intDesc->serializeFormat();
         const uint64_t data_hash = weightCache->GetHashFunc().hash(
                 internalBlob->buffer(), internalBlob->byteSize());
@@ -892,7 +927,19 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
         ptr = itr->second;
     } else {
         auto weightCache = context->getWeightsCache();
-        if (weightCache != nullptr) {
+        if (context->getConfig().shareWeightsAcrossModels) {
+            // content addressed key: the same weights packed the same way are shared by all the compiled models
+            using dnnl::impl::primitive_hashing::get_md_hash;
+            const uint64_t data_hash =
+                GlobalWeightsStore::contentHash(edgeMem->getData(), edgeMem->getSize(), weightCache);
+
+            const std::string string_hash = std::to_string(get_md_hash(*weightSrcDesc.get()))
+                                            + "_" + std::to_string(get_md_hash(*weightDesc->getDnnlDesc().get()))
+                                            + "_" + std::to_string(edgeMem->getSize())
+                                            + "_" + std::to_string(data_hash);
+
+            ptr = GlobalWeightsStore::instance()->findOrCreate(string_hash, context->getSocketId(), create);
+        } else if (weightCache != nullptr) {
             const std::string string_hash = getName() + "_" + format
                                             + "_" + std::to_string(edgeMem->getSize())
                                             + "_" + std::to_string(reinterpret_cast<uint64_t>(edgeMem->getData()));
@@ -1613,6 +1660,13 @@ IShapeInfer::Result Node::shapeInfer() const {
     }
 }
 
+void Node::disableShapeInferMemoization() {
+    if (memoizedShapeInference && memoizedShapeInference.get() == shapeInference.get()) {
+        shapeInference = memoizedShapeInference->getWrapped();
+    }
+    memoizedShapeInference.reset();
+}
+
 void Node::updateLastInputDims() {
     if (lastInputDims.size() != getParentEdges().size()) {
         if (!lastInputDims.empty())
@@ -33,6 +33,7 @@
 #include "cache/multi_cache.h"
 
 #include <utils/shape_inference/shape_inference_cpu.hpp>
+#include <utils/shape_inference/shape_inference_memoized.hpp>
 #include "utils/debug_capabilities.h"
 #include "utils/bit_util.hpp"
 
@@ -671,6 +672,8 @@ protected:
     virtual bool needShapeInfer() const;
     std::vector<VectorDims> shapeInferGeneric(const std::vector<Shape>& inputDims) const;
     IShapeInfer::Result shapeInfer() const;
+    // must be called by nodes whose shape inference updates the node state, so it has to run on every shape change
+    void disableShapeInferMemoization();
     // TODO [DS] : make pure after all nodes will be support dynamic shapes
     virtual void executeDynamicImpl(dnnl::stream strm) {
         IE_THROW(NotImplemented) << "[DS] executeDynamicImpl not implemented for node with type: " << getTypeStr();
@@ -693,8 +696,13 @@ protected:
     std::vector<VectorDims> lastInputDims = {};
 
     std::shared_ptr<IShapeInfer> shapeInference;
+    // set when shapeInference has no data dependency and is wrapped into the memoizing decorator
+    std::shared_ptr<MemoizedShapeInfer> memoizedShapeInference;
 
 private:
+    // reused between updateShapes() calls to avoid allocations on the dynamic inference path
+    std::vector<std::reference_wrapper<const VectorDims>> shapeInferInputs;
+
     std::vector<EdgeWeakPtr> parentEdges;
     std::vector<EdgeWeakPtr> childEdges;
 
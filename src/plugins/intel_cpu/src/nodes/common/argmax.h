@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Returns the index of the first maximum of data[0 .. size).
+ * The class dimension is scanned by independent lanes, each keeping its own running maximum, so the hot loop
+ * has no loop-carried dependency between neighbouring elements and is vectorized by the compiler into
+ * compare + blend instructions. The lanes are reduced at the end, preferring the lowest index among equal maxima,
+ * which matches a sequential scan with a strict comparison.
+ */
+inline int argmax(const float* data, int size) {
+    constexpr int lanes = 16;
+    if (size < 2 * lanes) {
+        int maxIdx = 0;
+        for (int c = 1; c < size; c++) {
+            if (data[c] > data[maxIdx])
+                maxIdx = c;
+        }
+        return maxIdx;
+    }
+
+    float laneMax[lanes];
+    int laneIdx[lanes];
+    for (int l = 0; l < lanes; l++) {
+        laneMax[l] = data[l];
+        laneIdx[l] = l;
+    }
+
+    int c = lanes;
+    for (; c + lanes <= size; c += lanes) {
+        for (int l = 0; l < lanes; l++) {
+            const bool greater = data[c + l] > laneMax[l];
+            laneMax[l] = greater ? data[c + l] : laneMax[l];
+            laneIdx[l] = greater ? c + l : laneIdx[l];
+        }
+    }
+
+    int maxIdx = laneIdx[0];
+    float maxVal = laneMax[0];
+    for (int l = 1; l < lanes; l++) {
+        if (laneMax[l] > maxVal || (laneMax[l] == maxVal && laneIdx[l] < maxIdx)) {
+            maxVal = laneMax[l];
+            maxIdx = laneIdx[l];
+        }
+    }
+    for (; c < size; c++) {
+        if (data[c] > maxVal) {
+            maxVal = data[c];
+            maxIdx = c;
+        }
+    }
+    return maxIdx;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
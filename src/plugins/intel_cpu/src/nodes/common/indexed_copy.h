@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include "cpu_memcpy.h"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Shared copy engine of the index driven data movement nodes (GatherND, GatherElements, ScatterUpdate,
+ * ScatterNDUpdate). Index tensors produced by real models (sorted ids, repeated rows, ranges) often address
+ * consecutive source or destination blocks, so consecutive blocks are detected and moved with a single copy.
+ */
+template <typename T>
+inline void copyRun(T* dst, const T* src, size_t count) {
+    if (count == 1) {
+        *dst = *src;
+    } else {
+        cpu_memcpy(dst, src, count * sizeof(T));
+    }
+}
+
+/**
+ * @brief Gathers blocks [start, end): dst + i * blockSize <- src + srcOffset(i), blocks of blockSize elements.
+ * srcOffset is evaluated exactly once per block and in increasing block order, so it may carry iteration state.
+ * Runs of consecutive source blocks are copied at once.
+ */
+template <typename T, typename SrcOffset>
+inline void gatherRuns(T* dst, const T* src, size_t blockSize, size_t start, size_t end, SrcOffset srcOffset) {
+    if (start >= end)
+        return;
+
+    size_t i = start;
+    size_t runSrc = srcOffset(i);
+    while (i < end) {
+        size_t runLen = 1;
+        size_t nextSrc = 0;
+        while (i + runLen < end) {
+            nextSrc = srcOffset(i + runLen);
+            if (nextSrc != runSrc + runLen * blockSize)
+                break;
+            runLen++;
+        }
+        copyRun(dst + i * blockSize, src + runSrc, runLen * blockSize);
+        i += runLen;
+        runSrc = nextSrc;
+    }
+}
+
+/**
+ * Scratch buffers of scatterRuns(). Nodes keep them as members, so repeated executions do not allocate.
+ */
+struct ScatterRunsBuffers {
+    std::vector<size_t> order;
+    std::vector<size_t> bucketBegin;
+};
+
+/**
+ * @brief Conflict-free parallel scatter: dst + dstOffsets[i] <- update + i * blockSize, blocks of blockSize bytes.
+ * The destination of dstSize bytes is split into per-thread ownership ranges and the updates are bucketed by their
+ * owning thread in one stable counting pass. Every thread then applies its own bucket in index order, so no two
+ * threads write the same block, duplicated indices deterministically resolve to the last update, and runs of
+ * consecutive destination blocks are copied at once. Offsets outside of the destination are ignored.
+ * dstOffsets must be multiples of blockSize.
+ */
+inline void scatterRuns(uint8_t* dst, const uint8_t* update, size_t blockSize, size_t dstSize,
+                        const std::vector<size_t>& dstOffsets, ScatterRunsBuffers& buffers) {
+    const size_t count = dstOffsets.size();
+    if (count == 0 || blockSize == 0)
+        return;
+
+    const size_t dstBlocks = dstSize / blockSize;
+    // small scatters are not worth the bucketing pass
+    const size_t minBytesPerThread = 32 * 1024;
+    const int nthr = static_cast<int>(std::min<size_t>(
+        std::min<size_t>(parallel_get_max_threads(), dstBlocks),
+        std::max<size_t>(1, count * blockSize / minBytesPerThread)));
+
+    if (nthr <= 1) {
+        size_t i = 0;
+        while (i < count) {
+            const size_t runDst = dstOffsets[i];
+            if (runDst >= dstSize) {
+                i++;
+                continue;
+            }
+            size_t runLen = 1;
+            while (i + runLen < count && dstOffsets[i + runLen] == runDst + runLen * blockSize &&
+                   runDst + runLen * blockSize < dstSize) {
+                runLen++;
+            }
+            cpu_memcpy(dst + runDst, update + i * blockSize, runLen * blockSize);
+            i += runLen;
+        }
+        return;
+    }
+
+    const size_t blocksPerThread = div_up(dstBlocks, static_cast<size_t>(nthr));
+    // bucketBegin[t + 1] counts the updates of thread t, the prefix sums then place them stably into order
+    auto& bucketBegin = buffers.bucketBegin;
+    bucketBegin.assign(nthr + 2, 0);
+    for (size_t i = 0; i < count; i++) {
+        if (dstOffsets[i] < dstSize)
+            bucketBegin[dstOffsets[i] / blockSize / blocksPerThread + 2]++;
+    }
+    for (int t = 2; t < nthr + 2; t++) {
+        bucketBegin[t] += bucketBegin[t - 1];
+    }
+    auto& order = buffers.order;
+    order.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        if (dstOffsets[i] < dstSize)
+            order[bucketBegin[dstOffsets[i] / blockSize / blocksPerThread + 1]++] = i;
+    }
+
+    // the placement shifted the prefix sums: the bucket of thread t is now [bucketBegin[t], bucketBegin[t + 1])
+    parallel_nt(nthr, [&](const int ithr, const int) {
+        const size_t end = bucketBegin[ithr + 1];
+        size_t j = bucketBegin[ithr];
+        while (j < end) {
+            const size_t i = order[j];
+            const size_t runDst = dstOffsets[i];
+            size_t runLen = 1;
+            while (j + runLen < end && order[j + runLen] == i + runLen &&
+                   dstOffsets[i + runLen] == runDst + runLen * blockSize) {
+                runLen++;
+            }
+            cpu_memcpy(dst + runDst, update + i * blockSize, runLen * blockSize);
+            j += runLen;
+        }
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
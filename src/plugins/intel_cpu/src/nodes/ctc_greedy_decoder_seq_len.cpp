@@ -8,6 +8,7 @@
 #include <ngraph/op/ctc_greedy_decoder_seq_len.hpp>
 #include "ie_parallel.hpp"
 #include "ctc_greedy_decoder_seq_len.h"
+#include "common/argmax.h"
 
 using namespace InferenceEngine;
 
@@ -126,17 +127,8 @@ void CTCGreedyDecoderSeqLen::execute(dnnl::stream strm) {
             const size_t actualSeqLen = sequenceLengths[b];
 
             for (size_t t = tStart; t < actualSeqLen; ++t) {
-                int maxClassIdx = 0;
-                float maxProb = probs[0];
-                probs++;
-
-                for (int c = 1; c < C; c++, probs++) {
-                    if (*probs > maxProb) {
-                        maxClassIdx = c;
-                        maxProb = *probs;
-                    }
-                }
-                decodedClasses[outputIndex++] = maxClassIdx;
+                decodedClasses[outputIndex++] = argmax(probs, C);
+                probs += C;
 
                 if (++workCounter >= end) {
                     return;
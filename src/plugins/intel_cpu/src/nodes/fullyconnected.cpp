@@ -26,7 +26,11 @@
 #include "common/primitive_desc.hpp"
 #include "common/primitive_desc_iface.hpp"
 #include "common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+#include <ie_parallel.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -139,6 +143,128 @@ private:
     std::shared_ptr<const ngraph::Node> m_op;
 };
 
+// Symmetric per-token quantization of the activations: every row gets its own scale amax / 127 and
+// is shifted by 128 to u8, since oneDNN int8 inner product with VNNI expects unsigned activations.
+template <typename T>
+void quantizeRows(const T* src, uint8_t* dst, float* rowScales, size_t M, size_t K) {
+    parallel_for(M, [&](size_t m) {
+        const T* x = src + m * K;
+        float amax = 0.f;
+        for (size_t k = 0; k < K; k++)
+            amax = std::max(amax, std::abs(static_cast<float>(x[k])));
+        const float scale = amax > 0.f ? amax / 127.f : 1.f;
+        const float invScale = 1.f / scale;
+        uint8_t* q = dst + m * K;
+        for (size_t k = 0; k < K; k++)
+            q[k] = static_cast<uint8_t>(std::nearbyint(static_cast<float>(x[k]) * invScale) + 128.f);
+        rowScales[m] = scale;
+    });
+}
+
+// y = (acc - 128 * sum(w_q)) * rowScale * wScale + bias, the column sums compensate the u8 shift
+template <typename T>
+void dequantizeRows(const int32_t* acc, T* dst, const float* rowScales, const float* wScales, const int32_t* colSums,
+                    const float* bias, size_t M, size_t N) {
+    parallel_for(M, [&](size_t m) {
+        const int32_t* a = acc + m * N;
+        T* y = dst + m * N;
+        const float rowScale = rowScales[m];
+        for (size_t n = 0; n < N; n++) {
+            float v = static_cast<float>(a[n] - 128 * colSums[n]) * rowScale * wScales[n];
+            if (bias)
+                v += bias[n];
+            y[n] = static_cast<T>(v);
+        }
+    });
+}
+
+// Packed structured sparse weights: the offsets of the active groups of every channels block [blocksNum + 1] (u32),
+// the active groups as byte offsets in the activations row (u32), then per active group the positions of the values
+// [slotsNum][channelsBlock] (u8) and, aligned to 64 bytes, the values of the same shape
+struct SparseWeightsLayout {
+    SparseWeightsLayout(size_t blocksNum, size_t groupsNum, size_t channelsBlock, const SparseFcKernelConfParams& conf) {
+        groupsOffset = (blocksNum + 1) * sizeof(uint32_t);
+        indicesOffset = groupsOffset + groupsNum * sizeof(uint32_t);
+        valuesOffset = rnd_up(indicesOffset + groupsNum * conf.slotsNum * channelsBlock, 64);
+        size = valuesOffset + groupsNum * conf.slotsNum * channelsBlock * conf.wPrc.size();
+    }
+
+    size_t groupsOffset;
+    size_t indicesOffset;
+    size_t valuesOffset;
+    size_t size;
+};
+
+// Collects the groups having non-zero weights for every channels block of the [N, K] weights.
+// Returns false if some output channel has more than slotsNum non-zero weights in a group.
+bool collectSparseGroups(const float* weights, size_t N, size_t K, size_t channelsBlock, const SparseFcKernelConfParams& conf,
+                         std::vector<std::vector<uint32_t>>& groups) {
+    const size_t groupSize = conf.groupSize;
+    groups.assign(div_up(N, channelsBlock), {});
+    std::atomic<bool> fits{true};
+    parallel_for(groups.size(), [&](size_t nb) {
+        const size_t nEnd = std::min(N, (nb + 1) * channelsBlock);
+        for (size_t g = 0; g < K / groupSize && fits; g++) {
+            bool active = false;
+            for (size_t n = nb * channelsBlock; n < nEnd; n++) {
+                const float* w = weights + n * K + g * groupSize;
+                const auto nnz = static_cast<size_t>(std::count_if(w, w + groupSize, [](float v) { return v != 0.f; }));
+                if (nnz > conf.slotsNum)
+                    fits = false;
+                active = active || nnz > 0;
+            }
+            if (active)
+                groups[nb].push_back(static_cast<uint32_t>(g));
+        }
+    });
+    return fits;
+}
+
+void packSparseWeights(const float* weights, size_t N, size_t K, size_t channelsBlock, const SparseFcKernelConfParams& conf,
+                       const std::vector<std::vector<uint32_t>>& groups, uint8_t* dst) {
+    const size_t blocksNum = groups.size();
+    auto* blockGroups = reinterpret_cast<uint32_t*>(dst);
+    blockGroups[0] = 0;
+    for (size_t nb = 0; nb < blocksNum; nb++)
+        blockGroups[nb + 1] = blockGroups[nb] + static_cast<uint32_t>(groups[nb].size());
+    const SparseWeightsLayout layout(blocksNum, blockGroups[blocksNum], channelsBlock, conf);
+    auto* groupOffsets = reinterpret_cast<uint32_t*>(dst + layout.groupsOffset);
+    // the dense groups (block sparsity) keep all the positions, the N:M ones - the non-zero values only
+    const bool skipZeros = conf.slotsNum < conf.groupSize;
+    const size_t slotsSize = conf.slotsNum * channelsBlock;
+
+    parallel_for(blocksNum, [&](size_t nb) {
+        for (size_t i = 0; i < groups[nb].size(); i++) {
+            const size_t groupIdx = blockGroups[nb] + i;
+            const size_t g = groups[nb][i];
+            groupOffsets[groupIdx] = static_cast<uint32_t>(g * conf.groupSize * sizeof(float));
+            uint8_t* indices = dst + layout.indicesOffset + groupIdx * slotsSize;
+            uint8_t* values = dst + layout.valuesOffset + groupIdx * slotsSize * conf.wPrc.size();
+            auto setValue = [&](size_t slot, size_t c, size_t pos, float v) {
+                indices[slot * channelsBlock + c] = static_cast<uint8_t>(pos);
+                if (conf.wPrc == Precision::BF16)
+                    reinterpret_cast<bfloat16_t*>(values)[slot * channelsBlock + c] = static_cast<bfloat16_t>(v);
+                else
+                    reinterpret_cast<float*>(values)[slot * channelsBlock + c] = v;
+            };
+            for (size_t c = 0; c < channelsBlock; c++) {
+                const size_t n = nb * channelsBlock + c;
+                size_t slot = 0;
+                if (n < N) {
+                    const float* w = weights + n * K + g * conf.groupSize;
+                    for (size_t pos = 0; pos < conf.groupSize; pos++) {
+                        if (skipZeros && w[pos] == 0.f)
+                            continue;
+                        setValue(slot++, c, pos, w[pos]);
+                    }
+                }
+                for (; slot < conf.slotsNum; slot++)
+                    setValue(slot, c, 0, 0.f);
+            }
+        }
+    });
+}
+
 } // namespace
 
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -315,6 +441,16 @@ void FullyConnected::getSupportedDescriptors() {
         }
     }
 #endif
+    useStructuredSparsity = canUseStructuredSparsity(inputDataType, weightsDataType);
+    if (useStructuredSparsity) {
+        useMlas = false;
+        return;
+    }
+    useDynamicQuantization = canUseDynamicQuantization(inputDataType, weightsDataType);
+    if (useDynamicQuantization) {
+        useMlas = false;
+        return;
+    }
     if (useMlas) return;
 
     for (auto format : getAvailableFormatsForDims(getInputShapeAtPort(0))) {
@@ -347,7 +483,14 @@ void FullyConnected::prepackMLASWeight() {
         };
 
         auto weightCache = context->getWeightsCache();
-        if (weightCache != nullptr) {
+        if (context->getConfig().shareWeightsAcrossModels) {
+            const uint64_t data_hash =
+                GlobalWeightsStore::contentHash(weightsMem->getData(), weightsMem->getSize(), weightCache);
+            const std::string string_hash = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                            std::to_string(weightsMem->getSize()) + "_" + std::to_string(data_hash);
+
+            ptr = GlobalWeightsStore::instance()->findOrCreate(string_hash, context->getSocketId(), create);
+        } else if (weightCache != nullptr) {
             std::string format = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K);
             const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
                                             "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
@@ -370,6 +513,18 @@ void FullyConnected::prepackMLASWeight() {
 #endif
 
 void FullyConnected::createPrimitive() {
+    if (useStructuredSparsity) {
+        // the packed weights and the kernel are needed by prepareParams, so prepare them first
+        prepareStructuredSparseWeights();
+        Node::createPrimitive();
+        return;
+    }
+    if (useDynamicQuantization) {
+        // the quantized weights are needed by prepareParams, so prepare them first
+        prepareDynamicQuantizationWeights();
+        Node::createPrimitive();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         Node::createPrimitive();
@@ -400,6 +555,14 @@ void FullyConnected::prepareParams() {
     NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+    if (useStructuredSparsity) {
+        prepareStructuredSparseParams();
+        return;
+    }
+    if (useDynamicQuantization) {
+        prepareDynamicQuantizationParams();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     // M should be normalized and updated
     if (useMlas) {
@@ -567,7 +730,396 @@ void FullyConnected::executeMLAS() {
 
 #endif
 
+bool FullyConnected::canUseDynamicQuantization(memory::data_type inputDataType, memory::data_type weightsDataType) const {
+    // the dequantization pass applies the scales and the bias only, so the nodes with fused operations (activations
+    // like GELU included) keep the regular path
+    if (!context->getConfig().fcDynamicQuantization || useSparseWeights || useStructuredSparsity || !fusedWith.empty())
+        return false;
+    // without VNNI the int8 inner product is not faster than the floating point one
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_vnni) &&
+        !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2_vnni))
+        return false;
+    if (!one_of(inputDataType, memory::data_type::f32, memory::data_type::bf16) ||
+        !one_of(weightsDataType, memory::data_type::f32, memory::data_type::bf16) ||
+        !one_of(outputDataType, memory::data_type::f32, memory::data_type::bf16))
+        return false;
+    return hasPlainWeightsAndChannelBias();
+}
+
+bool FullyConnected::hasPlainWeightsAndChannelBias() const {
+    // same restrictions as MLAS: plain [N, K] weights and per channel bias
+    const auto& wgtDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    for (size_t i = 2; i < wgtDims.size(); i++) {
+        if (wgtDims[i] != 1)
+            return false;
+    }
+    if (withBiases) {
+        const auto& biasDims = getInputShapeAtPort(BIAS_ID).getStaticDims();
+        if (biasDims.back() != outDims.back())
+            return false;
+        for (size_t i = 0; i < biasDims.size() - 1; i++) {
+            if (biasDims[i] != 1)
+                return false;
+        }
+    }
+    return true;
+}
+
+void FullyConnected::prepareDynamicQuantizationWeights() {
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+    const auto& wgtDims = weightsMem->getStaticDims();
+    dqN = wgtDims[0];
+    dqK = wgtDims[1];
+    const size_t N = dqN;
+    const size_t K = dqK;
+
+    auto create = [&]() {
+        std::vector<float> weights(N * K);
+        cpu_convert(weightsMem->getData(), weights.data(), weightsMem->getDesc().getPrecision(), Precision::FP32, N * K);
+        const size_t scalesOffset = rnd_up(N * K, 64);
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(),
+            intel_cpu::CpuBlockedMemoryDesc(Precision::I8, intel_cpu::Shape{scalesOffset + 2 * N * sizeof(float)}));
+        auto* dst = reinterpret_cast<int8_t*>(_ptr->getData());
+        auto* scales = reinterpret_cast<float*>(dst + scalesOffset);
+        auto* colSums = reinterpret_cast<int32_t*>(scales + N);
+        parallel_for(N, [&](size_t n) {
+            const float* w = &weights[n * K];
+            float amax = 0.f;
+            for (size_t k = 0; k < K; k++)
+                amax = std::max(amax, std::abs(w[k]));
+            const float scale = amax > 0.f ? amax / 127.f : 1.f;
+            int32_t sum = 0;
+            for (size_t k = 0; k < K; k++) {
+                const auto q = static_cast<int8_t>(std::max(-127.f, std::min(127.f, std::nearbyint(w[k] / scale))));
+                dst[n * K + k] = q;
+                sum += q;
+            }
+            scales[n] = scale;
+            colSums[n] = sum;
+        });
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (context->getConfig().shareWeightsAcrossModels) {
+        const uint64_t data_hash =
+            GlobalWeightsStore::contentHash(weightsMem->getData(), weightsMem->getSize(), weightCache);
+        const std::string string_hash = "fc_dq_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                        std::to_string(weightsMem->getSize()) + "_" + std::to_string(data_hash);
+
+        dqWeightsPtr = GlobalWeightsStore::instance()->findOrCreate(string_hash, context->getSocketId(), create);
+    } else if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_fc_dq_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                        std::to_string(weightsMem->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+
+        dqWeightsPtr = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        dqWeightsPtr = create();
+    }
+}
+
+void FullyConnected::prepareDynamicQuantizationParams() {
+    const auto& dstDims = getChildEdgeAt(0)->getMemoryPtr()->getStaticDims();
+    dqM = std::accumulate(dstDims.begin(), dstDims.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    auto inDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::U8, Shape(VectorDims{dqM, dqK}));
+    auto weightDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::I8, Shape(VectorDims{dqN, dqK}));
+    auto outDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::I32, Shape(VectorDims{dqM, dqN}));
+    dnnl::primitive_attr dqAttr;
+    dqAttr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    FCKey key = {inDesc, weightDesc, nullptr, outDesc, dqAttr, impl_desc_type::undef, false};
+
+    auto& engine = getEngine();
+    auto builder = [&engine](const FCKey& key) -> executorPtr {
+        auto wghDescAny = dnnl::memory::desc(key.inp1->getDnnlDesc().get_dims(), memory::data_type::s8, memory::format_tag::any);
+        auto prim_desc = dnnl::inner_product_forward::primitive_desc(engine,
+                                                                     dnnl::prop_kind::forward_inference,
+                                                                     key.inp0->getDnnlDesc(),
+                                                                     wghDescAny,
+                                                                     key.out->getDnnlDesc(),
+                                                                     key.attr);
+        return std::make_shared<DnnlExecutor>(prim_desc);
+    };
+
+    auto result = context->getParamsCache()->getOrCreate(key, builder);
+    if (!result.first) {
+        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+    }
+    execPtr = result.first;
+
+    // the packed int8 weights depend only on the layout chosen by oneDNN, so they survive shape changes
+    const auto& format = execPtr->getWeightDesc()->serializeFormat();
+    auto itr = dqPackedWeights.find(format);
+    if (itr == dqPackedWeights.end()) {
+        auto create = [&]() {
+            Memory srcMemory{engine, weightDesc, dqWeightsPtr->getData()};
+            MemoryPtr _ptr = std::make_shared<Memory>(engine, execPtr->getWeightDesc());
+            node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
+            return _ptr;
+        };
+
+        MemoryPtr ptr;
+        auto weightCache = context->getWeightsCache();
+        if (weightCache != nullptr && !context->getConfig().shareWeightsAcrossModels) {
+            const std::string string_hash = getName() + "_fc_dq_packed_" + format + "_" +
+                                            std::to_string(reinterpret_cast<uint64_t>(dqWeightsPtr->getData()));
+            ptr = *weightCache->findOrCreate(string_hash, create);
+        } else {
+            ptr = create();
+        }
+        itr = dqPackedWeights.emplace(format, ptr).first;
+    }
+
+    dqSrcPtr = std::make_shared<Memory>(engine, execPtr->getSrcDesc());
+    dqAccPtr = std::make_shared<Memory>(engine, execPtr->getDstDesc());
+    dqRowScales.resize(dqM);
+
+    primArgs[DNNL_ARG_SRC] = dqSrcPtr->getPrimitive();
+    primArgs[DNNL_ARG_WEIGHTS] = itr->second->getPrimitive();
+    primArgs[DNNL_ARG_DST] = dqAccPtr->getPrimitive();
+    primArgs[DNNL_ARG_SCRATCHPAD] = getScratchPadMem(execPtr->getScratchPadDesc())->getPrimitive();
+    getSelectedPrimitiveDescriptor()->setImplementationType(execPtr->getImplementationType());
+}
+
+void FullyConnected::executeDynamicQuantization(dnnl::stream strm) {
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto biasMemPtr = withBiases ? getParentEdgeAt(BIAS_ID)->getMemoryPtr() : nullptr;
+
+    auto* srcU8 = reinterpret_cast<uint8_t*>(dqSrcPtr->getData());
+    if (srcMemPtr->getDesc().getPrecision() == Precision::BF16) {
+        quantizeRows(reinterpret_cast<const bfloat16_t*>(srcMemPtr->getData()), srcU8, dqRowScales.data(), dqM, dqK);
+    } else {
+        quantizeRows(reinterpret_cast<const float*>(srcMemPtr->getData()), srcU8, dqRowScales.data(), dqM, dqK);
+    }
+
+    execPtr->exec(primArgs, strm);
+
+    const auto* wScales = reinterpret_cast<const float*>(reinterpret_cast<const int8_t*>(dqWeightsPtr->getData()) +
+                                                         rnd_up(dqN * dqK, 64));
+    const auto* colSums = reinterpret_cast<const int32_t*>(wScales + dqN);
+    const auto* bias = biasMemPtr ? reinterpret_cast<const float*>(biasMemPtr->getData()) : nullptr;
+    const auto* acc = reinterpret_cast<const int32_t*>(dqAccPtr->getData());
+    if (dstMemPtr->getDesc().getPrecision() == Precision::BF16) {
+        dequantizeRows(acc, reinterpret_cast<bfloat16_t*>(dstMemPtr->getData()), dqRowScales.data(), wScales, colSums, bias, dqM, dqN);
+    } else {
+        dequantizeRows(acc, reinterpret_cast<float*>(dstMemPtr->getData()), dqRowScales.data(), wScales, colSums, bias, dqM, dqN);
+    }
+}
+
+bool FullyConnected::canUseStructuredSparsity(memory::data_type inputDataType, memory::data_type weightsDataType) {
+#if defined(OPENVINO_ARCH_X86_64)
+    // minSparseRate == 1 means that sparse feature is switched off
+    if (minSparseRate == 1.f || useSparseWeights || !fusedWith.empty() || !decompressionMultiply.empty())
+        return false;
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2))
+        return false;
+    if (!one_of(inputDataType, memory::data_type::f32, memory::data_type::bf16) ||
+        !one_of(weightsDataType, memory::data_type::f32, memory::data_type::bf16) ||
+        !one_of(outputDataType, memory::data_type::f32, memory::data_type::bf16))
+        return false;
+    // the dense bf16 AMX inner product is faster than the sparse kernel
+    if (inputDataType == memory::data_type::bf16 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx))
+        return false;
+    if (!hasPlainWeightsAndChannelBias())
+        return false;
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!constNode) {
+        return false;
+    }
+    auto blb = constNode->getMemoryPtr();
+    if (blb == nullptr)
+        IE_THROW() << "Cannot get const blob for node " << getName() << ".";
+
+    const auto& wgtDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t N = wgtDims[0];
+    const size_t K = wgtDims[1];
+    std::vector<float> weights(N * K);
+    cpu_convert(blb->getData(), weights.data(), blb->getDesc().getPrecision(), Precision::FP32, N * K);
+
+    const auto zerosCount = static_cast<size_t>(std::count(weights.begin(), weights.end(), 0.f));
+    weiSparseRate = static_cast<float>(zerosCount) / static_cast<float>(N * K);
+    if (weiSparseRate < minSparseRate) {
+        return false;
+    }
+
+    // the patterns are compared by the number of the stored values, the kernel pays off if it halves them at least
+    const size_t channelsBlock = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ? 16 : 8;
+    const size_t denseSlots = div_up(N, channelsBlock) * K;
+    size_t bestSlots = denseSlots / 2 + 1;
+    // 2:4, 4:8 and the zero blocks of 4 input channels
+    const std::vector<std::pair<uint64_t, uint64_t>> patterns = {{4, 2}, {8, 4}, {4, 4}};
+    for (const auto& pattern : patterns) {
+        SparseFcKernelConfParams conf;
+        conf.groupSize = pattern.first;
+        conf.slotsNum = pattern.second;
+        std::vector<std::vector<uint32_t>> groups;
+        if (K % conf.groupSize != 0 || !collectSparseGroups(weights.data(), N, K, channelsBlock, conf, groups))
+            continue;
+        size_t slots = 0;
+        for (const auto& blockGroups : groups)
+            slots += blockGroups.size() * conf.slotsNum;
+
+        DEBUG_LOG(getName(), " | sparse pattern ", conf.slotsNum, ":", conf.groupSize, ", stored values = ", slots,
+                  " of ", denseSlots, " vectors");
+
+        if (slots < bestSlots) {
+            bestSlots = slots;
+            spConf = conf;
+        }
+    }
+    if (bestSlots > denseSlots / 2)
+        return false;
+
+    spConf.wPrc = inputDataType == memory::data_type::bf16 ? Precision::BF16 : Precision::FP32;
+    spConf.withBias = withBiases;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void FullyConnected::prepareStructuredSparseWeights() {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
+        spKernel.reset(new SparseFcKernel<dnnl::impl::cpu::x64::avx512_core>(spConf));
+    } else {
+        spKernel.reset(new SparseFcKernel<dnnl::impl::cpu::x64::avx2>(spConf));
+    }
+    spKernel->setKernelCache(context->getKernelCache());
+    spKernel->create_ker();
+
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+    const auto& wgtDims = weightsMem->getStaticDims();
+    spN = wgtDims[0];
+    spK = wgtDims[1];
+    const size_t N = spN;
+    const size_t K = spK;
+    const size_t channelsBlock = spKernel->getChannelsBlock();
+
+    auto create = [&]() {
+        std::vector<float> weights(N * K);
+        cpu_convert(weightsMem->getData(), weights.data(), weightsMem->getDesc().getPrecision(), Precision::FP32, N * K);
+        std::vector<std::vector<uint32_t>> groups;
+        if (!collectSparseGroups(weights.data(), N, K, channelsBlock, spConf, groups))
+            IE_THROW() << "Weights of node " << getName() << " don't fit the sparse pattern.";
+        size_t groupsNum = 0;
+        for (const auto& blockGroups : groups)
+            groupsNum += blockGroups.size();
+        const SparseWeightsLayout layout(groups.size(), groupsNum, channelsBlock, spConf);
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(),
+            intel_cpu::CpuBlockedMemoryDesc(Precision::U8, intel_cpu::Shape{layout.size}));
+        packSparseWeights(weights.data(), N, K, channelsBlock, spConf, groups, reinterpret_cast<uint8_t*>(_ptr->getData()));
+        return _ptr;
+    };
+
+    const std::string format = "fc_sparse_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                               std::to_string(spConf.slotsNum) + "_" + std::to_string(spConf.groupSize) + "_" +
+                               std::to_string(channelsBlock) + "_" + spConf.wPrc.name();
+    auto weightCache = context->getWeightsCache();
+    if (context->getConfig().shareWeightsAcrossModels) {
+        const uint64_t data_hash =
+            GlobalWeightsStore::contentHash(weightsMem->getData(), weightsMem->getSize(), weightCache);
+        const std::string string_hash = format + "_" + std::to_string(weightsMem->getSize()) + "_" + std::to_string(data_hash);
+
+        spWeightsPtr = GlobalWeightsStore::instance()->findOrCreate(string_hash, context->getSocketId(), create);
+    } else if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+
+        spWeightsPtr = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        spWeightsPtr = create();
+    }
+#endif
+}
+
+void FullyConnected::prepareStructuredSparseParams() {
+    const auto& dstDims = getChildEdgeAt(0)->getMemoryPtr()->getStaticDims();
+    spM = std::accumulate(dstDims.begin(), dstDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t paddedN = rnd_up(spN, spKernel->getChannelsBlock());
+
+    if (getParentEdgeAt(DATA_ID)->getMemoryPtr()->getDesc().getPrecision() != Precision::FP32)
+        spSrc.resize(spM * spK);
+    if (getChildEdgeAt(0)->getMemoryPtr()->getDesc().getPrecision() != Precision::FP32 || paddedN != spN)
+        spDst.resize(spM * paddedN);
+    if (withBiases && spBias.empty()) {
+        // the kernel loads the bias of the whole channels block
+        const auto biasMemPtr = getParentEdgeAt(BIAS_ID)->getMemoryPtr();
+        spBias.resize(paddedN, 0.f);
+        cpu_convert(biasMemPtr->getData(), spBias.data(), biasMemPtr->getDesc().getPrecision(), Precision::FP32, spN);
+    }
+}
+
+void FullyConnected::executeStructuredSparse() {
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto srcPrecision = srcMemPtr->getDesc().getPrecision();
+    const auto dstPrecision = dstMemPtr->getDesc().getPrecision();
+    const size_t channelsBlock = spKernel->getChannelsBlock();
+    const size_t paddedN = rnd_up(spN, channelsBlock);
+
+    const auto* src = reinterpret_cast<const float*>(srcMemPtr->getData());
+    if (srcPrecision != Precision::FP32) {
+        cpu_convert(srcMemPtr->getData(), spSrc.data(), srcPrecision, Precision::FP32, spM * spK);
+        src = spSrc.data();
+    }
+    const bool directDst = dstPrecision == Precision::FP32 && paddedN == spN;
+    auto* dst = directDst ? reinterpret_cast<float*>(dstMemPtr->getData()) : spDst.data();
+
+    const auto* packed = reinterpret_cast<const uint8_t*>(spWeightsPtr->getData());
+    const size_t blocksNum = paddedN / channelsBlock;
+    const auto* blockGroups = reinterpret_cast<const uint32_t*>(packed);
+    const SparseWeightsLayout layout(blocksNum, blockGroups[blocksNum], channelsBlock, spConf);
+    const auto* groups = reinterpret_cast<const uint32_t*>(packed + layout.groupsOffset);
+    const size_t indicesStep = spConf.slotsNum * channelsBlock;
+    const size_t valuesStep = indicesStep * spConf.wPrc.size();
+
+    // the weights of a channels block are reused by the rows of the chunk from the cache
+    const size_t rowsChunk = 64;
+    parallel_for2d(div_up(spM, rowsChunk), blocksNum, [&](size_t mc, size_t nb) {
+        const size_t m = mc * rowsChunk;
+        SparseFcKernelExecArgs args;
+        args.src = src + m * spK;
+        args.values = packed + layout.valuesOffset + blockGroups[nb] * valuesStep;
+        args.indices = packed + layout.indicesOffset + blockGroups[nb] * indicesStep;
+        args.groups = groups + blockGroups[nb];
+        args.bias = withBiases ? spBias.data() + nb * channelsBlock : nullptr;
+        args.dst = dst + m * paddedN + nb * channelsBlock;
+        args.groupsNum = blockGroups[nb + 1] - blockGroups[nb];
+        args.rowsNum = std::min(rowsChunk, spM - m);
+        args.srcStrideB = spK * sizeof(float);
+        args.dstStrideB = paddedN * sizeof(float);
+        (*spKernel)(&args);
+    });
+
+    if (!directDst) {
+        auto* dstData = reinterpret_cast<uint8_t*>(dstMemPtr->getData());
+        parallel_for(spM, [&](size_t m) {
+            cpu_convert(spDst.data() + m * paddedN, dstData + m * spN * dstPrecision.size(), Precision::FP32, dstPrecision, spN);
+        });
+    }
+}
+
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useDynamicQuantization) {
+        executeDynamicQuantization(strm);
+        return;
+    }
+    if (useStructuredSparsity) {
+        executeStructuredSparse();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         executeMLAS();
@@ -663,6 +1215,8 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
         impl_desc_type::unknown,
         impl_desc_type::acl,
         impl_desc_type::brgemm_sparse_avx512_amx,
+        impl_desc_type::jit_sparse_avx512,
+        impl_desc_type::jit_sparse_avx2,
         impl_desc_type::brgemm_avx512_amx,
         impl_desc_type::brgemm_avx512,
         impl_desc_type::brgemm_avx2,
@@ -809,6 +1363,25 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
         }
         return;
     }
+    if (useDynamicQuantization || useStructuredSparsity) {
+        const auto dataPrecision = getOriginalInputPrecisionAtPort(DATA_ID);
+        const auto weightsPrecision = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+        const auto outputPrecision = DnnlExtensionUtils::DataTypeToIEPrecision(outputDataType);
+        impl_desc_type implType;
+        if (useDynamicQuantization) {
+            implType = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_vnni) ?
+                       impl_desc_type::brgemm_avx512 : impl_desc_type::brgemm_avx2;
+        } else {
+            implType = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ?
+                       impl_desc_type::jit_sparse_avx512 : impl_desc_type::jit_sparse_avx2;
+        }
+        std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, dataPrecision},
+                                                 {LayoutType::ncsp, weightsPrecision}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, outputPrecision}}, implType);
+        return;
+    }
     // 3D FC requires implicit reshape so strides should be defined
     auto supportsUndefStridesAndOffset = [&]() {
         return getOutputShapeAtPort(0).getRank() == 2;
@@ -893,6 +1466,8 @@ std::shared_ptr<MemoryDesc> FullyConnected::getDstMemDesc(const dnnl::primitive_
 }
 
 InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
+    if (useDynamicQuantization)
+        return Precision::I8;
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
     size_t inputsNumLimit = 2;
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "kernels/x64/sparse_fc.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -115,6 +116,38 @@ private:
     void prepackMLASWeight();
 #endif
 
+    // dynamic per-token activation quantization: f32/bf16 activations are quantized to u8 row by row
+    // at runtime and multiplied by per-output-channel symmetric s8 weights in an int8 inner product
+    bool useDynamicQuantization = false;
+    size_t dqM = 0, dqN = 0, dqK = 0;
+    // s8 weights [N, K] followed by N float weight scales and N int32 column sums
+    MemoryPtr dqWeightsPtr = nullptr;
+    MemoryPtr dqSrcPtr = nullptr;
+    MemoryPtr dqAccPtr = nullptr;
+    std::vector<float> dqRowScales;
+    std::unordered_map<std::string, MemoryPtr> dqPackedWeights;
+    bool canUseDynamicQuantization(dnnl::memory::data_type inputDataType, dnnl::memory::data_type weightsDataType) const;
+    bool hasPlainWeightsAndChannelBias() const;
+    void prepareDynamicQuantizationWeights();
+    void prepareDynamicQuantizationParams();
+    void executeDynamicQuantization(dnnl::stream strm);
+
+    // structured sparse (N:M or zero blocks) weights on the platforms without the AMX sparse inner product,
+    // computed by SparseFcKernel over the packed non-zero values and their positions
+    bool useStructuredSparsity = false;
+    size_t spM = 0, spN = 0, spK = 0;
+    SparseFcKernelConfParams spConf;
+    // see packSparseWeights for the layout
+    MemoryPtr spWeightsPtr = nullptr;
+    std::shared_ptr<SparseFcKernelBase> spKernel;
+    std::vector<float> spSrc;
+    std::vector<float> spDst;
+    std::vector<float> spBias;
+    bool canUseStructuredSparsity(dnnl::memory::data_type inputDataType, dnnl::memory::data_type weightsDataType);
+    void prepareStructuredSparseWeights();
+    void prepareStructuredSparseParams();
+    void executeStructuredSparse();
+
     std::vector<float> decompressionSubtract;
     std::vector<float> decompressionMultiply;
 };
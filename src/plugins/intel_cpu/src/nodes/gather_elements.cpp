@@ -7,6 +7,7 @@
 #include <string>
 #include "ie_parallel.hpp"
 #include "gather_elements.h"
+#include "common/indexed_copy.h"
 #include <ngraph/opsets/opset1.hpp>
 #include <precision_utils.h>
 #include <utils/general_utils.h>
@@ -118,8 +119,11 @@ void GatherElements::directExecution() {
         int dstAxIdx = (start / strideAxDst_) % dstAxDim_;
         int dstShift0 = (start / strideAxDst_ / dstAxDim_) * strideAx1Diff_;
 
-        for (int o = start; o < end; o++, axStrideIt++) {
-            if (axStrideIt == strideAxDst_) {
+        // gatherRuns visits the outputs one by one in increasing order, so the axis counters advance incrementally.
+        // Equal indices within a stride block address consecutive source elements and are copied as one run.
+        bool first = true;
+        gatherRuns(dstData, srcData, 1lu, start, end, [&](size_t o) {
+            if (!first && ++axStrideIt == strideAxDst_) {
                 axStrideIt = 0;
                 dstAxIdx++;
                 if (dstAxIdx == dstAxDim_) {
@@ -127,8 +131,9 @@ void GatherElements::directExecution() {
                     dstShift0 += strideAx1Diff_;
                 }
             }
-            dstData[o] = srcData[o + dstShift0 + (indices[o] - dstAxIdx) * strideAxDst_];
-        }
+            first = false;
+            return static_cast<size_t>(static_cast<int>(o) + dstShift0 + (indices[o] - dstAxIdx) * strideAxDst_);
+        });
     };
 
     parallel_nt(0, threadBody);
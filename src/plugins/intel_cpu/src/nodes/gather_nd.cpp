@@ -12,6 +12,7 @@
 #include <precision_utils.h>
 #include <utils/general_utils.h>
 #include "common/cpu_memcpy.h"
+#include "common/indexed_copy.h"
 
 using namespace InferenceEngine;
 
@@ -157,31 +158,7 @@ void GatherND::GatherNDExecutor::gatherBlocks(const MemoryPtr& srcMemPtr, const
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
         splitter(workAmount, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-        size_t bStart = start / cycles;
-        size_t cStart = start % cycles;
-        size_t workCounter = start;
-
-        const uint8_t* shiftedSrcData = srcData + bStart * srcBatchStride;
-        const int32_t* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
-        uint8_t* shiftedDstData = dstData + bStart * dstBatchStride + cStart * dataLength;
-
-        for (size_t b = bStart; b < batchSize; b++) {
-            for (size_t j = cStart; j < cycles; j++) {
-                size_t dataIdx = 0lu;
-                for (size_t i = 0; i < sliceRank; i++)
-                    dataIdx += srcShifts[i] * shiftedIndices[i];
-                cpu_memcpy(shiftedDstData, &(shiftedSrcData[dataIdx]), dataLength);
-                shiftedDstData += dataLength;
-                shiftedIndices += sliceRank;
-                if (++workCounter == end) {
-                    return;
-                }
-            }
-            cStart = 0;
-            shiftedSrcData += srcBatchStride;
-        }
+        gatherRange(dstData, srcData, dataLength, indices, start, end);
     });
 }
 
@@ -194,31 +171,23 @@ void GatherND::GatherNDExecutor::gatherElementwise(const MemoryPtr& srcMemPtr, c
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
         splitter(workAmount, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-        size_t bStart = start / cycles;
-        size_t cStart = start % cycles;
-        size_t workCounter = start;
-
-        const dataType* shiftedSrcData = srcData + bStart * srcBatchStride;
-        const int32_t* shiftedIndices = indices + bStart * idxBatchStride + cStart * sliceRank;
-        dataType* shiftedDstData = dstData + bStart * dstBatchStride + cStart * dataLength;
-
-        for (size_t b = bStart; b < batchSize; b++) {
-            for (size_t j = cStart; j < cycles; j++) {
-                size_t dataIdx = 0lu;
-                for (size_t i = 0lu; i < sliceRank; i++)
-                    dataIdx += srcShifts[i] * shiftedIndices[i];
-                shiftedDstData[0] = shiftedSrcData[dataIdx];
-                shiftedDstData++;
-                shiftedIndices += sliceRank;
-                if (++workCounter == end) {
-                    return;
-                }
-            }
-            cStart = 0lu;
-            shiftedSrcData += srcBatchStride;
-        }
+        gatherRange(dstData, srcData, 1lu, indices, start, end);
+    });
+}
+
+// Work item w = b * cycles + j copies the slice addressed by the j-th index tuple of batch b. The output slices
+// are dense, so dst block w directly follows dst block w - 1 and runs of adjacent source slices (sorted or
+// sequential indices) are merged into one copy by gatherRuns.
+template <typename dataType>
+void GatherND::GatherNDExecutor::gatherRange(dataType* dstData, const dataType* srcData, size_t blockSize,
+                                             const int32_t* indices, size_t start, size_t end) const {
+    gatherRuns(dstData, srcData, blockSize, start, end, [&](size_t w) {
+        const size_t b = w / cycles;
+        const int32_t* tuple = indices + b * idxBatchStride + (w - b * cycles) * sliceRank;
+        size_t dataIdx = b * srcBatchStride;
+        for (size_t i = 0; i < sliceRank; i++)
+            dataIdx += srcShifts[i] * tuple[i];
+        return dataIdx;
     });
 }
 
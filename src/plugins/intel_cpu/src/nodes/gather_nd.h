@@ -49,6 +49,9 @@ private:
         template <typename dataType>
         void gatherElementwise(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, const MemoryPtr& dstMemPtr);
         void gatherBlocks(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, const MemoryPtr& dstMemPtr);
+        template <typename dataType>
+        void gatherRange(dataType* dstData, const dataType* srcData, size_t blockSize,
+                         const int32_t* indices, size_t start, size_t end) const;
 
         size_t batchSize = 1lu;
         size_t cycles = 1lu;
@@ -145,6 +145,7 @@ void GridSample::createPrimitive() {
     if (!jitKernel) {
         THROW_ERROR << " could not create JIT kernel.";
     }
+    jitKernel->setKernelCache(context->getKernelCache());
     jitKernel->create_ker();
 
     nthr = parallel_get_max_threads();
@@ -0,0 +1,360 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "image_preprocess.h"
+#include "ie_parallel.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+class ImagePreprocessShapeInfer : public ShapeInferEmptyPads {
+public:
+    explicit ImagePreprocessShapeInfer(const ImagePreprocessNode& op)
+        : m_attrs(op.get_attrs()),
+          m_singlePlane(op.get_planes_count() == 1),
+          m_runtimeTargetSize(op.has_runtime_target_size()),
+          m_targetSizePort(op.get_planes_count()) {}
+    Result infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const auto& imageDims = input_shapes[0].get();
+        size_t height = imageDims[1], width = imageDims[2], channels = imageDims[3];
+        if (!m_attrs.color_format.empty()) {
+            height = m_singlePlane ? height * 2 / 3 : height;
+            channels = 3;
+        }
+        if (m_runtimeTargetSize) {
+            const auto* targetSize = reinterpret_cast<const int32_t*>(data_dependency.at(m_targetSizePort)->getData());
+            height = targetSize[0];
+            width = targetSize[1];
+        } else if (!m_attrs.target_size.empty()) {
+            height = m_attrs.target_size[0];
+            width = m_attrs.target_size[1];
+        }
+        VectorDims outputDims = m_attrs.nchw_output ? VectorDims{imageDims[0], channels, height, width}
+                                                    : VectorDims{imageDims[0], height, width, channels};
+        return {{std::move(outputDims)}, ShapeInferStatus::success};
+    }
+    port_mask_t get_port_mask() const override {
+        return m_runtimeTargetSize ? PortMask(m_targetSizePort) : EMPTY_PORT_MASK;
+    }
+
+private:
+    ImagePreprocessNode::Attributes m_attrs;
+    bool m_singlePlane;
+    bool m_runtimeTargetSize;
+    size_t m_targetSizePort;
+};
+
+class ImagePreprocessShapeInferFactory : public ShapeInferFactory {
+public:
+    ImagePreprocessShapeInferFactory(const std::shared_ptr<ov::Node>& op) : m_op(op) {}
+    ShapeInferPtr makeShapeInfer() const override {
+        auto preprocess = ov::as_type_ptr<ImagePreprocessNode>(m_op);
+        if (!preprocess) {
+            IE_THROW(Unexpected) << "Wrong operation type";
+        }
+        return std::make_shared<ImagePreprocessShapeInfer>(*preprocess);
+    }
+private:
+    std::shared_ptr<ov::Node> m_op;
+};
+
+constexpr size_t invalidRow = std::numeric_limits<size_t>::max();
+
+// the same conversion as in the reference NV12/I420 to RGB implementations
+inline void yuvToRgb(float y, float u, float v, bool roundColor, float* rgb) {
+    const float c = y - 16.f;
+    const float d = u - 128.f;
+    const float e = v - 128.f;
+    auto clip = [roundColor](float a) {
+        return std::min(std::max(roundColor ? std::round(a) : a, 0.f), 255.f);
+    };
+    rgb[0] = clip(1.164f * c + 1.596f * e);
+    rgb[1] = clip(1.164f * c - 0.391f * d - 0.813f * e);
+    rgb[2] = clip(1.164f * c + 2.018f * d);
+}
+}   // namespace
+
+bool ImagePreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto preprocess = ov::as_type_ptr<const ImagePreprocessNode>(op);
+        if (!preprocess) {
+            errorMessage = "Only ImagePreprocess from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+ImagePreprocess::ImagePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, ImagePreprocessShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ImagePreprocess node with name '" + getName() + "'";
+    const auto preprocess = ov::as_type_ptr<const ImagePreprocessNode>(op);
+    const auto& attrs = preprocess->get_attrs();
+    colorFormat = attrs.color_format == "NV12" ? ColorFormat::NV12 :
+                  attrs.color_format == "I420" ? ColorFormat::I420 : ColorFormat::PACKED;
+    bgr = attrs.bgr;
+    roundColor = attrs.round_color;
+    resize = !attrs.resize_mode.empty();
+    nearest = attrs.resize_mode == "nearest";
+    nchwOutput = attrs.nchw_output;
+    runtimeTargetSize = preprocess->has_runtime_target_size();
+    planesNum = preprocess->get_planes_count();
+    scale = attrs.scale;
+    shift = attrs.shift;
+}
+
+void ImagePreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    srcPrecision = getOriginalInputPrecisionAtPort(0);
+    if (srcPrecision != InferenceEngine::Precision::U8) {
+        srcPrecision = InferenceEngine::Precision::FP32;
+    }
+
+    std::vector<PortConfigurator> inConfs(planesNum, {LayoutType::ncsp, srcPrecision});
+    if (runtimeTargetSize) {
+        inConfs.push_back({LayoutType::ncsp, InferenceEngine::Precision::I32});
+    }
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, InferenceEngine::Precision::FP32}},
+                         ref_any);
+}
+
+const int32_t* ImagePreprocess::getTargetSize() const {
+    return reinterpret_cast<const int32_t*>(getParentEdgeAt(planesNum)->getMemoryPtr()->getData());
+}
+
+bool ImagePreprocess::needShapeInfer() const {
+    if (Node::needShapeInfer()) {
+        return true;
+    }
+    if (!runtimeTargetSize) {
+        return false;
+    }
+    const auto* targetSize = getTargetSize();
+    return lastTargetSize.empty() || !std::equal(lastTargetSize.begin(), lastTargetSize.end(), targetSize);
+}
+
+bool ImagePreprocess::needPrepareParams() const {
+    const auto& dstDims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    return inputShapesModified() || dstDims[nchwOutput ? 2 : 1] != dstH || dstDims[nchwOutput ? 3 : 2] != dstW;
+}
+
+void ImagePreprocess::initTaps(Taps& taps, size_t srcLen, size_t dstLen) const {
+    taps.idx0.resize(dstLen);
+    taps.idx1.resize(dstLen);
+    taps.w0.resize(dstLen);
+    taps.w1.resize(dstLen);
+    // half_pixel coordinates with the scale computed as by Interpolate in the sizes mode
+    const float ratio = static_cast<float>(dstLen) / static_cast<float>(srcLen);
+    const float maxCoord = static_cast<float>(srcLen - 1);
+    for (size_t i = 0; i < dstLen; i++) {
+        const float coord = (static_cast<float>(i) + 0.5f) / ratio - 0.5f;
+        if (nearest) {
+            // round_prefer_floor
+            const float floorCoord = std::floor(coord);
+            const float nearestCoord = coord == floorCoord + 0.5f ? floorCoord : std::round(coord);
+            taps.idx0[i] = taps.idx1[i] = static_cast<size_t>(std::min(std::max(nearestCoord, 0.f), maxCoord));
+            taps.w0[i] = 1.f;
+            taps.w1[i] = 0.f;
+        } else {
+            // blending of the two nearest pixels with the coordinate clamped to the image is equal to the reference
+            // linear modes without antialias, which skip the pixels outside the image and normalize the weights
+            const float clamped = std::min(std::max(coord, 0.f), maxCoord);
+            const auto idx = static_cast<size_t>(clamped);
+            taps.idx0[i] = idx;
+            taps.idx1[i] = std::min(idx + 1, srcLen - 1);
+            taps.w1[i] = clamped - static_cast<float>(idx);
+            taps.w0[i] = 1.f - taps.w1[i];
+        }
+    }
+}
+
+void ImagePreprocess::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemoryPtr()->getStaticDims();
+    const auto& dstDims = getChildEdgesAtPort(0)[0]->getMemoryPtr()->getStaticDims();
+    batch = srcDims[0];
+    srcH = colorFormat != ColorFormat::PACKED && planesNum == 1 ? srcDims[1] * 2 / 3 : srcDims[1];
+    srcW = srcDims[2];
+    channels = colorFormat != ColorFormat::PACKED ? 3 : srcDims[3];
+    dstH = nchwOutput ? dstDims[2] : dstDims[1];
+    dstW = nchwOutput ? dstDims[3] : dstDims[2];
+    if (srcH == 0 || srcW == 0) {
+        IE_THROW() << errorPrefix << " has empty input image";
+    }
+    if (!resize && (dstH != srcH || dstW != srcW)) {
+        IE_THROW() << errorPrefix << " has unexpected output shape";
+    }
+
+    // y = x * scale + shift for each channel
+    if (scale.size() != channels) {
+        scale.assign(channels, scale.empty() ? 1.f : scale[0]);
+        shift.assign(channels, shift.empty() ? 0.f : shift[0]);
+    }
+
+    initTaps(xTaps, srcW, dstW);
+    initTaps(yTaps, srcH, dstH);
+
+    // two horizontally resampled source rows per thread, allocated here to keep the execution free of the heap
+    rowsBuffer.resize(parallel_get_max_threads() * 2 * dstW * channels);
+}
+
+template <typename T>
+void ImagePreprocess::sampleRow(size_t b, size_t row, float* dst) const {
+    const auto* plane0 = reinterpret_cast<const T*>(getParentEdgeAt(0)->getMemoryPtr()->getData());
+    const auto& x0 = xTaps.idx0;
+    const auto& x1 = xTaps.idx1;
+    const auto& w0 = xTaps.w0;
+    const auto& w1 = xTaps.w1;
+
+    if (colorFormat == ColorFormat::PACKED) {
+        const T* src = plane0 + (b * srcH + row) * srcW * channels;
+        for (size_t ox = 0; ox < dstW; ox++) {
+            const T* p0 = src + x0[ox] * channels;
+            const T* p1 = src + x1[ox] * channels;
+            for (size_t c = 0; c < channels; c++) {
+                dst[ox * channels + c] = w0[ox] * static_cast<float>(p0[c]) + w1[ox] * static_cast<float>(p1[c]);
+            }
+        }
+        return;
+    }
+
+    // chroma is subsampled by 2 in both dimensions, NV12 interleaves U and V, I420 stores them in separate planes
+    const size_t imageSize = srcH * srcW;
+    const size_t chromaWidth = colorFormat == ColorFormat::NV12 ? srcW : srcW / 2;
+    const size_t chromaStep = colorFormat == ColorFormat::NV12 ? 2 : 1;
+    const T *yRow = nullptr, *uRow = nullptr, *vRow = nullptr;
+    if (planesNum == 1) {
+        const T* image = plane0 + b * imageSize * 3 / 2;
+        yRow = image + row * srcW;
+        uRow = image + imageSize + (row / 2) * chromaWidth;
+        vRow = colorFormat == ColorFormat::NV12 ? uRow + 1 : uRow + imageSize / 4;
+    } else {
+        const auto* plane1 = reinterpret_cast<const T*>(getParentEdgeAt(1)->getMemoryPtr()->getData());
+        const size_t chromaOffset = (b * (srcH / 2) + row / 2) * chromaWidth;
+        yRow = plane0 + (b * srcH + row) * srcW;
+        uRow = plane1 + chromaOffset;
+        vRow = colorFormat == ColorFormat::NV12
+                   ? uRow + 1
+                   : reinterpret_cast<const T*>(getParentEdgeAt(2)->getMemoryPtr()->getData()) + chromaOffset;
+    }
+
+    const size_t red = bgr ? 2 : 0;
+    const size_t blue = bgr ? 0 : 2;
+    float rgb0[3], rgb1[3];
+    for (size_t ox = 0; ox < dstW; ox++) {
+        const size_t c0 = (x0[ox] / 2) * chromaStep;
+        yuvToRgb(yRow[x0[ox]], uRow[c0], vRow[c0], roundColor, rgb0);
+        if (x1[ox] != x0[ox]) {
+            const size_t c1 = (x1[ox] / 2) * chromaStep;
+            yuvToRgb(yRow[x1[ox]], uRow[c1], vRow[c1], roundColor, rgb1);
+        } else {
+            std::copy(rgb0, rgb0 + 3, rgb1);
+        }
+        float* out = dst + ox * 3;
+        out[red] = w0[ox] * rgb0[0] + w1[ox] * rgb1[0];
+        out[1] = w0[ox] * rgb0[1] + w1[ox] * rgb1[1];
+        out[blue] = w0[ox] * rgb0[2] + w1[ox] * rgb1[2];
+    }
+}
+
+template <typename T>
+const float* ImagePreprocess::getRow(size_t b, size_t row, CachedRow* cache) const {
+    const size_t key = b * srcH + row;
+    if (cache[0].row == key)
+        return cache[0].data;
+    if (cache[1].row == key)
+        return cache[1].data;
+    // the rows are requested in non-decreasing order, so the lower one is not needed anymore
+    auto age = [](size_t cached) { return cached == invalidRow ? 0 : cached + 1; };
+    auto& slot = age(cache[0].row) <= age(cache[1].row) ? cache[0] : cache[1];
+    sampleRow<T>(b, row, slot.data);
+    slot.row = key;
+    return slot.data;
+}
+
+template <typename T>
+void ImagePreprocess::executeImpl() {
+    auto* dstData = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->getData());
+    const size_t rowSize = dstW * channels;
+
+    // each thread produces a band of output rows, so that the source rows shared by the neighbouring output rows
+    // are converted and resampled horizontally once
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(batch * dstH, nthr, ithr, start, end);
+        float* buffer = rowsBuffer.data() + ithr * 2 * rowSize;
+        CachedRow cache[2] = {{invalidRow, buffer}, {invalidRow, buffer + rowSize}};
+        for (size_t i = start; i < end; i++) {
+            const size_t b = i / dstH;
+            const size_t oy = i % dstH;
+            const float* row0 = getRow<T>(b, yTaps.idx0[oy], cache);
+            const float* row1 = getRow<T>(b, yTaps.idx1[oy], cache);
+            const float w0 = yTaps.w0[oy];
+            const float w1 = yTaps.w1[oy];
+            if (nchwOutput) {
+                for (size_t c = 0; c < channels; c++) {
+                    float* dst = dstData + ((b * channels + c) * dstH + oy) * dstW;
+                    for (size_t ox = 0; ox < dstW; ox++) {
+                        const size_t idx = ox * channels + c;
+                        dst[ox] = (w0 * row0[idx] + w1 * row1[idx]) * scale[c] + shift[c];
+                    }
+                }
+            } else {
+                float* dst = dstData + (b * dstH + oy) * rowSize;
+                for (size_t ox = 0; ox < dstW; ox++) {
+                    for (size_t c = 0; c < channels; c++) {
+                        const size_t idx = ox * channels + c;
+                        dst[idx] = (w0 * row0[idx] + w1 * row1[idx]) * scale[c] + shift[c];
+                    }
+                }
+            }
+        }
+    });
+}
+
+void ImagePreprocess::execute(dnnl::stream strm) {
+    if (srcPrecision == InferenceEngine::Precision::U8) {
+        executeImpl<uint8_t>();
+    } else if (srcPrecision == InferenceEngine::Precision::FP32) {
+        executeImpl<float>();
+    } else {
+        IE_THROW() << errorPrefix << " has unsupported input precision " << srcPrecision;
+    }
+}
+
+void ImagePreprocess::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+    if (runtimeTargetSize) {
+        const auto* targetSize = getTargetSize();
+        lastTargetSize.assign(targetSize, targetSize + 2);
+    }
+}
+
+bool ImagePreprocess::created() const {
+    return getType() == Type::ImagePreprocess;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
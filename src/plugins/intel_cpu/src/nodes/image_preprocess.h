@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class ImagePreprocess : public Node {
+public:
+    ImagePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    bool needShapeInfer() const override;
+    bool needPrepareParams() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+private:
+    enum class ColorFormat {
+        PACKED,
+        NV12,
+        I420
+    };
+
+    // source pixels and weights blended into one output pixel along one axis
+    struct Taps {
+        std::vector<size_t> idx0;
+        std::vector<size_t> idx1;
+        std::vector<float> w0;
+        std::vector<float> w1;
+    };
+
+    // source row which has been converted and resampled horizontally
+    struct CachedRow {
+        size_t row;
+        float* data;
+    };
+
+    void initTaps(Taps& taps, size_t srcLen, size_t dstLen) const;
+    template <typename T>
+    void executeImpl();
+    template <typename T>
+    void sampleRow(size_t b, size_t row, float* dst) const;
+    template <typename T>
+    const float* getRow(size_t b, size_t row, CachedRow* cache) const;
+    const int32_t* getTargetSize() const;
+
+    ColorFormat colorFormat = ColorFormat::PACKED;
+    bool bgr = false;
+    bool roundColor = false;
+    bool resize = false;
+    bool nearest = false;
+    bool nchwOutput = false;
+    bool runtimeTargetSize = false;
+    size_t planesNum = 1;
+    std::vector<float> scale;
+    std::vector<float> shift;
+
+    size_t batch = 0;
+    size_t srcH = 0;
+    size_t srcW = 0;
+    size_t channels = 0;
+    size_t dstH = 0;
+    size_t dstW = 0;
+    Taps xTaps;
+    Taps yTaps;
+    std::vector<float> rowsBuffer;
+    std::vector<int32_t> lastTargetSize;
+
+    InferenceEngine::Precision srcPrecision;
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
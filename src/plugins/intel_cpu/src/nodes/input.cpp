@@ -372,15 +372,37 @@ void Input::cloneBlobIfRequired() {
 
     auto weightCache = context->getWeightsCache();
 
+    // Weights imported from a mapped compiled model blob are shared with the mapping as is, so they are paged in
+    // on first use instead of being copied into the weights cache. The subnormals are still flushed the same way as
+    // on a fresh compilation: unless DAZ is on (denormals optimization), hasSubnormals() reads every page of an fp32
+    // constant here, so such weights are paged in at import time and only the copy is saved, not the loading.
+    if (context->getConfig().mappedWeights && isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA()) {
+        memoryPtr = std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
+        return;
+    }
+
+    // the copies of the constant are shared by all the compiled models of the process
+    const bool shareAcrossModels = context->getConfig().shareWeightsAcrossModels;
+    auto sharedBlob = [&] () {
+        const uint64_t data_hash = GlobalWeightsStore::contentHash(constOp->get_data_ptr(), constOp->get_byte_size(),
+                                                                   weightCache);
+        const std::string string_hash = "const_" + prec.name()
+                                        + "_" + MemoryDescUtils::dims2str(shape.getStaticDims())
+                                        + "_" + std::to_string(needFlushDenormalsToZero)
+                                        + "_" + std::to_string(constOp->get_byte_size())
+                                        + "_" + std::to_string(data_hash);
+        return GlobalWeightsStore::instance()->findOrCreate(string_hash, context->getSocketId(), cloneBlob);
+    };
+
     if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        MemoryPtr ptr = shareAcrossModels ? sharedBlob() : *weightCache->findOrCreate(blobKey(), cloneBlob);
         memoryPtr = std::const_pointer_cast<const IMemory>(ptr);
     // IRs already have all subnormals flushed to zero, but in
     // read_model scenario with directly loaded original model still can have subnormals
     } else if (isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA()) {
         memoryPtr = std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
     } else {
-        memoryPtr = std::const_pointer_cast<const IMemory>(cloneBlob());
+        memoryPtr = std::const_pointer_cast<const IMemory>(shareAcrossModels ? sharedBlob() : cloneBlob());
     }
 }
 
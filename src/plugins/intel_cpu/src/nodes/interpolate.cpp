@@ -3333,15 +3333,12 @@ void Interpolate::InterpolateRefExecutor::NNRef(const uint8_t *in_ptr_, uint8_t
     const float *in_ptr_f32 = reinterpret_cast<const float *>(in_ptr_);
     float *out_ptr_f32 = reinterpret_cast<float *>(out_ptr_);
 
-    parallel_for3d(B, C, OD, [&](size_t b, size_t c, size_t od) {
-        const float *in_ptr = in_ptr_f32 + (IW * IH * ID * C * b + IW * IH * ID * c + IW * IH * index_d[od]);
-        float *out_ptr = out_ptr_f32 + (OW * OH * OD * C * b + OW * OH * OD * c + OW * OH * od);
-        for (int oh = 0; oh < OH; oh++) {
-            const float *in_ptr_h = in_ptr + (IW * index_h[oh]);
-            float *out_ptr_h = out_ptr + (OW * oh);
-            for (int ow = 0; ow < OW; ow++) {
-                out_ptr_h[ow] = in_ptr_h[index_w[ow]];
-            }
+    // parallel over rows, so that a single image with few channels still keeps all threads busy
+    parallel_for4d(B, C, OD, OH, [&](size_t b, size_t c, size_t od, size_t oh) {
+        const float *in_ptr_h = in_ptr_f32 + (IW * IH * ID * C * b + IW * IH * ID * c + IW * IH * index_d[od] + IW * index_h[oh]);
+        float *out_ptr_h = out_ptr_f32 + (OW * OH * OD * C * b + OW * OH * OD * c + OW * OH * od + OW * oh);
+        for (int ow = 0; ow < OW; ow++) {
+            out_ptr_h[ow] = in_ptr_h[index_w[ow]];
         }
     });
 }
@@ -3379,13 +3376,17 @@ void Interpolate::InterpolateRefExecutor::linearOnnxRef(const uint8_t *in_ptr_,
     const float *in_ptr_f32 = reinterpret_cast<const float *>(in_ptr_);
     float *out_ptr_f32 = reinterpret_cast<float *>(out_ptr_);
 
-    parallel_for2d(B, C, [&](size_t b, size_t c) {
+    // the outputs of every (b, c) plane are additionally split by rows, each row covers OW consecutive table entries
+    const int rowsNum = (spatialDimSize > 2) ? OD * OH : ((spatialDimSize > 1) ? OH : 1);
+    parallel_for3d(B, C, rowsNum, [&](size_t b, size_t c, size_t row) {
         float *out_ptr_nc = out_ptr_f32 + (OD * OH * OW * C * b + OD * OH * OW * c);
         const float *in_ptr_nc = in_ptr_f32 + (ID * IH * IW * C * b + ID * IH * IW * c);
+        const int rowStart = static_cast<int>(row) * OW;
+        const int rowEnd = rowStart + OW;
         // do not combined 1d/2d to 3d unified process to get rid of invalid computing.
         switch (spatialDimSize) {
             case 1:
-                for (int i = 0; i < OW; i++) {
+                for (int i = rowStart; i < rowEnd; i++) {
                     float src0 = in_ptr_nc[indexPtr[0][i]];
                     float src1 = in_ptr_nc[indexPtr[1][i]];
 
@@ -3394,7 +3395,7 @@ void Interpolate::InterpolateRefExecutor::linearOnnxRef(const uint8_t *in_ptr_,
                 }
                 break;
             case 2:
-                for (int i = 0; i < OH * OW; i++) {
+                for (int i = rowStart; i < rowEnd; i++) {
                     float src00 = in_ptr_nc[indexPtr[0][i]];
                     float src01 = in_ptr_nc[indexPtr[1][i]];
                     float src10 = in_ptr_nc[indexPtr[2][i]];
@@ -3407,7 +3408,7 @@ void Interpolate::InterpolateRefExecutor::linearOnnxRef(const uint8_t *in_ptr_,
                 }
                 break;
             case 3:
-                for (int i = 0; i < OD * OH * OW; i++) {
+                for (int i = rowStart; i < rowEnd; i++) {
                     float src000 = in_ptr_nc[indexPtr[0][i]];
                     float src001 = in_ptr_nc[indexPtr[1][i]];
                     float src010 = in_ptr_nc[indexPtr[2][i]];
@@ -3454,25 +3455,56 @@ void Interpolate::InterpolateRefExecutor::cubicRef(const uint8_t *in_ptr_, uint8
     const float *in_ptr_f32 = reinterpret_cast<const float *>(in_ptr_);
     float *out_ptr_f32 = reinterpret_cast<float *>(out_ptr_);
 
-    parallel_for4d(B, C, OH, OW, [&](size_t n, size_t c, size_t oy, size_t ox) {
+    // source columns are clamped once per output column instead of once per output pixel
+    std::vector<int> xIndex(CUBIC_GRID_LEN * OW);
+    for (int ox = 0; ox < OW; ox++) {
+        for (int j = 0; j < CUBIC_GRID_LEN; j++) {
+            xIndex[ox * CUBIC_GRID_LEN + j] = std::max(0, std::min(xOrigin[ox] - 1 + j, IW - 1));
+        }
+    }
+
+    // The filter is applied separably. Horizontally filtered source rows are cached in a ring of CUBIC_GRID_LEN rows
+    // indexed by the source row, as neighbouring output rows share most of their source rows; the vertical pass is then
+    // a weighted sum of contiguous rows. Output rows are split in blocks so that a single image is still processed
+    // by all threads.
+    const int rowBlock = 16;
+    const int blocksNum = div_up(OH, rowBlock);
+    std::vector<float> rowsBuf(static_cast<size_t>(parallel_get_max_threads()) * CUBIC_GRID_LEN * OW);
+
+    parallel_for3d(B, C, blocksNum, [&](size_t n, size_t c, size_t blk) {
         const float *in_ptr_nc = in_ptr_f32 + (IW * IH * C * n + IW * IH * c);
         float *out_ptr_nc = out_ptr_f32 + (OW * OH * C * n + OW * OH * c);
+        float *rows = &rowsBuf[parallel_get_thread_num() * CUBIC_GRID_LEN * OW];
+        int rowTags[CUBIC_GRID_LEN] = {-1, -1, -1, -1};
+
+        const int oyEnd = std::min(OH, static_cast<int>(blk + 1) * rowBlock);
+        for (int oy = static_cast<int>(blk) * rowBlock; oy < oyEnd; oy++) {
+            const float *srcRows[CUBIC_GRID_LEN];
+            for (int i = 0; i < CUBIC_GRID_LEN; i++) {
+                const int iy = std::max(0, std::min(yOrigin[oy] - 1 + i, IH - 1));
+                // up to CUBIC_GRID_LEN consecutive source rows are used at once, so they never share a ring slot
+                const int slot = iy % CUBIC_GRID_LEN;
+                float *row = rows + slot * OW;
+                if (rowTags[slot] != iy) {
+                    const float *in_ptr_nch = in_ptr_nc + IW * iy;
+                    for (int ox = 0; ox < OW; ox++) {
+                        const int *idx = &xIndex[ox * CUBIC_GRID_LEN];
+                        const float *w = &xFactor[ox * CUBIC_GRID_LEN];
+                        row[ox] = w[0] * in_ptr_nch[idx[0]] + w[1] * in_ptr_nch[idx[1]] +
+                                  w[2] * in_ptr_nch[idx[2]] + w[3] * in_ptr_nch[idx[3]];
+                    }
+                    rowTags[slot] = iy;
+                }
+                srcRows[i] = row;
+            }
 
-        int iy = yOrigin[oy];
-        int ix = xOrigin[ox];
-
-        float retY = 0.f;
-        for (int y = iy - 1, i = 0; y <= iy + 2; y++, i++) {
-            int yInRange = std::max(0, std::min(y, IH - 1));
-            const float *in_ptr_nch = in_ptr_nc + IW * yInRange;
-            float retX = 0.f;
-            for (int x = ix - 1, j = 0; x <= ix + 2; x++, j++) {
-                int xInRange = std::max(0, std::min(x, IW - 1));
-                retX += xFactor[ox * CUBIC_GRID_LEN + j] * in_ptr_nch[xInRange];
+            const float *w = &yFactor[oy * CUBIC_GRID_LEN];
+            float *out_ptr_nch = out_ptr_nc + oy * OW;
+            for (int ox = 0; ox < OW; ox++) {
+                out_ptr_nch[ox] = w[0] * srcRows[0][ox] + w[1] * srcRows[1][ox] +
+                                  w[2] * srcRows[2][ox] + w[3] * srcRows[3][ox];
             }
-            retY += yFactor[oy * CUBIC_GRID_LEN + i] * retX;
         }
-        out_ptr_nc[oy * OW + ox] = retY;
     });
 }
 
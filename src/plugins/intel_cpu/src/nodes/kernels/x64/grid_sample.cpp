@@ -4,6 +4,8 @@
 
 #include "grid_sample.hpp"
 
+#include <sstream>
+
 using namespace dnnl::impl::cpu;
 
 namespace ov {
@@ -27,12 +29,26 @@ GridSampleKernel<isa>::GridSampleKernel(const GridSampleKernelConfParams& jcp) :
 
 template <x64::cpu_isa_t isa>
 void GridSampleKernel<isa>::create_ker() {
-    auto code = x64::jit_generator::create_kernel();
+    auto code = create_kernel();
     if (code != dnnl::impl::status::success)
         IE_THROW() << "Could not create GridSample kernel. Error code: " << std::to_string(code);
     ker_ = (decltype(ker_))jit_ker();
 }
 
+template <x64::cpu_isa_t isa>
+std::string GridSampleKernel<isa>::persistentCacheKey() const {
+    // the kernel refers only to its own static tables, so the code does not depend on the process
+    std::ostringstream key;
+    key << jit_name() << "|isa=" << isa
+        << "|dyn=" << jcp.dynamicShapes << jcp.dynamicBatch << jcp.dynamicChannel
+        << "|align=" << jcp.alignCorners
+        << "|interp=" << static_cast<int>(jcp.interpolationMode)
+        << "|pad=" << static_cast<int>(jcp.paddingMode)
+        << "|prc=" << jcp.inDataPrc.name() << "," << jcp.gridPrc.name()
+        << "|b=" << jcp.batchNum << "|c=" << jcp.cannelNum << "|step=" << jcp.srcBatchStepB;
+    return key.str();
+}
+
 template <x64::cpu_isa_t isa>
 void GridSampleKernel<isa>::generate() {
     this->preamble();
@@ -98,6 +98,11 @@ public:
     void create_ker() override;
     void generate() override;
 
+protected:
+    std::string persistentCacheKey() const override;
+
+public:
+
     using Vmm   = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::avx512_core, Xbyak::Zmm,
                                                            isa == dnnl::impl::cpu::x64::sse41,       Xbyak::Xmm,
                                                                                                      Xbyak::Ymm>::type;
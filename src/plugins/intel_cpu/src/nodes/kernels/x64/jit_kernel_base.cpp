@@ -4,10 +4,64 @@
 
 #include "jit_kernel_base.hpp"
 
+#include <map>
+
 using namespace ov;
 using namespace intel_cpu;
 using namespace dnnl::impl::cpu;
 
+dnnl::impl::status_t JitKernelBase::create_kernel() {
+    const auto key = kernelCache ? persistentCacheKey() : std::string{};
+    if (key.empty())
+        return jit_generator::create_kernel();
+
+    KernelDiskCache::Image image;
+    if (kernelCache->load(key, image)) {
+        emitCodeImage(*this, image);
+        cachedKer = getCode();
+        return cachedKer ? dnnl::impl::status::success : dnnl::impl::status::runtime_error;
+    }
+
+    const auto status = jit_generator::create_kernel();
+    if (status == dnnl::impl::status::success &&
+        KernelDiskCache::makeImage(jit_generator::jit_ker(), getSize(), image)) {
+        kernelCache->store(key, image);
+    }
+    return status;
+}
+
+void JitKernelBase::emitCodeImage(x64::jit_generator& generator, const KernelDiskCache::Image& image) {
+    // the addresses inside the code are emitted as label addresses, so they are valid wherever the code is placed
+    std::map<uint64_t, Xbyak::Label> labels;
+    for (const auto& r : image.relocations) {
+        if (r.module == KernelDiskCache::SELF)
+            labels[r.target];
+    }
+
+    auto reloc = image.relocations.begin();
+    auto label = labels.begin();
+    const size_t size = image.code.size();
+    size_t pos = 0;
+    while (true) {
+        for (; label != labels.end() && label->first == pos; ++label)
+            generator.L(label->second);
+        if (pos == size)
+            break;
+        if (reloc != image.relocations.end() && reloc->offset == pos) {
+            if (reloc->module == KernelDiskCache::SELF) {
+                generator.putL(labels[reloc->target]);
+            } else {
+                generator.dq(image.moduleBases[reloc->module] + reloc->target);
+            }
+            pos += sizeof(uint64_t);
+            ++reloc;
+            continue;
+        }
+        generator.db(image.code[pos]);
+        pos++;
+    }
+}
+
 
 void JitKernelBase::uni_vfmsub132ps(const Xbyak::Xmm& vDst,
                                     const Xbyak::Xmm& vSrc,
@@ -6,6 +6,7 @@
 
 #include "cpu/x64/jit_generator.hpp"
 #include "registers_pool.hpp"
+#include "cache/kernel_disk_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -19,6 +20,20 @@ class JitKernelBase: public dnnl::impl::cpu::x64::jit_generator {
 public:
     JitKernelBase(const char* name) : dnnl::impl::cpu::x64::jit_generator(name) {}
 
+    // Generates the kernel or takes its code from the persistent kernel cache, see persistentCacheKey()
+    dnnl::impl::status_t create_kernel() override;
+
+    const Xbyak::uint8* jit_ker() const {
+        return cachedKer ? cachedKer : jit_generator::jit_ker();
+    }
+
+    void setKernelCache(const KernelDiskCache::Ptr& cache) {
+        kernelCache = cache;
+    }
+
+    // Emits the code image loaded from the persistent kernel cache, the relocated addresses are resolved by Xbyak
+    static void emitCodeImage(dnnl::impl::cpu::x64::jit_generator& generator, const KernelDiskCache::Image& image);
+
     void uni_vfmsub132ps(const Xbyak::Xmm& vDst, const Xbyak::Xmm& vSrc, const Xbyak::Operand& op);
 
     void uni_vfnmadd132ps(const Xbyak::Xmm& vDst, const Xbyak::Xmm& vSrc, const Xbyak::Operand& op);
@@ -140,6 +155,13 @@ protected:
         return dnnl::impl::cpu::x64::mayiuse(isa);
     }
 
+    // Has to describe the generated code completely (ISA, precisions, all the parameters affecting the code),
+    // the kernels with the empty key are not stored in the persistent kernel cache. The kernels with a key must not
+    // call or jump to the code outside the kernel by rel32, see KernelDiskCache
+    virtual std::string persistentCacheKey() const {
+        return {};
+    }
+
     RegistersPool::Ptr registersPool;
 
     enum {
@@ -153,6 +175,10 @@ protected:
         CMP_NLE_PS,    // Not-less-than-or-equal (unordered, signaling)
         CMP_ORD_PS     // Ordered (non-signaling)
     };
+
+private:
+    KernelDiskCache::Ptr kernelCache;
+    const Xbyak::uint8* cachedKer = nullptr;
 };
 
 } // namespace intel_cpu
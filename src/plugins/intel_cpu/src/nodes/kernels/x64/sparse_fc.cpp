@@ -0,0 +1,160 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc.hpp"
+
+#include <sstream>
+
+using namespace dnnl::impl::cpu;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(SparseFcKernelExecArgs, field)
+
+template <x64::cpu_isa_t isa>
+SparseFcKernel<isa>::SparseFcKernel(const SparseFcKernelConfParams& jcp) :
+        SparseFcKernelBase(jit_name(), jcp) {
+    channelsBlock = x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+    if (!one_of(jcp.groupSize, 4lu, 8lu) || jcp.slotsNum == 0 || jcp.slotsNum > jcp.groupSize)
+        IE_THROW() << "SparseFc kernel does not support group size " << jcp.groupSize << " with " << jcp.slotsNum << " slots.";
+}
+
+template <x64::cpu_isa_t isa>
+void SparseFcKernel<isa>::create_ker() {
+    auto code = create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create SparseFc kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+std::string SparseFcKernel<isa>::persistentCacheKey() const {
+    // the kernel has no references to the memory outside of the call arguments
+    std::ostringstream key;
+    key << jit_name() << "|isa=" << isa
+        << "|group=" << jcp.groupSize << "|slots=" << jcp.slotsNum
+        << "|prc=" << jcp.wPrc.name() << "|bias=" << jcp.withBias;
+    return key.str();
+}
+
+template <x64::cpu_isa_t isa>
+void SparseFcKernel<isa>::generate() {
+    this->preamble();
+
+    mov(regSrc,       ptr[regParams + GET_OFF(src)]);
+    mov(regDst,       ptr[regParams + GET_OFF(dst)]);
+    mov(regRows,      ptr[regParams + GET_OFF(rowsNum)]);
+    mov(regSrcStride, ptr[regParams + GET_OFF(srcStrideB)]);
+    mov(regDstStride, ptr[regParams + GET_OFF(dstStrideB)]);
+
+    // the full blocks of rows in the loop, then the rest by halves: each of them runs once at most
+    for (uint64_t rows = rowsBlock; rows > 0; rows /= 2) {
+        Xbyak::Label lLoop, lEnd;
+        L(lLoop);
+        {
+            cmp(regRows, rows);
+            jl(lEnd, T_NEAR);
+
+            rowsLoop(rows);
+
+            sub(regRows, rows);
+            if (rows == rowsBlock)
+                jmp(lLoop, T_NEAR);
+        }
+        L(lEnd);
+    }
+
+    this->postamble();
+}
+
+template <x64::cpu_isa_t isa>
+void SparseFcKernel<isa>::rowsLoop(uint64_t rows) {
+    if (jcp.withBias) {
+        mov(regAux, ptr[regParams + GET_OFF(bias)]);
+        for (uint64_t r = 0; r < rows; r++)
+            uni_vmovups(vAcc(r), ptr[regAux]);
+    } else {
+        for (uint64_t r = 0; r < rows; r++)
+            uni_vpxor(vAcc(r), vAcc(r), vAcc(r));
+    }
+
+    mov(regValues,    ptr[regParams + GET_OFF(values)]);
+    mov(regIndices,   ptr[regParams + GET_OFF(indices)]);
+    mov(regGroups,    ptr[regParams + GET_OFF(groups)]);
+    mov(regGroupsNum, ptr[regParams + GET_OFF(groupsNum)]);
+
+    const auto valuesStep  = channelsBlock * jcp.wPrc.size();
+    const auto indicesStep = channelsBlock;
+
+    Xbyak::Label lGroupLoop, lGroupEnd;
+    test(regGroupsNum, regGroupsNum);
+    jz(lGroupEnd, T_NEAR);
+    L(lGroupLoop);
+    {
+        mov(regAux.cvt32(), dword[regGroups]);
+        lea(regRow, ptr[regSrc + regAux]);
+        for (uint64_t r = 0; r < rows; r++) {
+            broadcastGroup(vSrc(r), ptr[regRow]);
+            if (r + 1 < rows)
+                add(regRow, regSrcStride);
+        }
+
+        for (uint64_t s = 0; s < jcp.slotsNum; s++) {
+            vpmovzxbd(vIdx, ptr[regIndices + s * indicesStep]);
+            loadValues(vWei, ptr[regValues + s * valuesStep]);
+            for (uint64_t r = 0; r < rows; r++) {
+                vpermps(vAux, vIdx, vSrc(r));
+                vfmadd231ps(vAcc(r), vAux, vWei);
+            }
+        }
+
+        add(regValues, jcp.slotsNum * valuesStep);
+        add(regIndices, jcp.slotsNum * indicesStep);
+        add(regGroups, sizeof(uint32_t));
+        dec(regGroupsNum);
+        jnz(lGroupLoop, T_NEAR);
+    }
+    L(lGroupEnd);
+
+    mov(regRow, regDst);
+    for (uint64_t r = 0; r < rows; r++) {
+        uni_vmovups(ptr[regRow], vAcc(r));
+        add(regRow, regDstStride);
+        add(regSrc, regSrcStride);
+    }
+    mov(regDst, regRow);
+}
+
+template <x64::cpu_isa_t isa>
+void SparseFcKernel<isa>::broadcastGroup(const Vmm& vDst, const Xbyak::Address& addr) {
+    // vpermps takes the positions from the whole vector, so the group is repeated in it
+    if (isa == x64::avx512_core) {
+        if (jcp.groupSize == 4)
+            vbroadcastf32x4(Xbyak::Zmm(vDst.getIdx()), addr);
+        else
+            vbroadcastf32x8(Xbyak::Zmm(vDst.getIdx()), addr);
+    } else {
+        if (jcp.groupSize == 4)
+            vbroadcastf128(Xbyak::Ymm(vDst.getIdx()), addr);
+        else
+            vmovups(Xbyak::Ymm(vDst.getIdx()), addr);
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void SparseFcKernel<isa>::loadValues(const Vmm& vDst, const Xbyak::Address& addr) {
+    if (jcp.wPrc == InferenceEngine::Precision::BF16) {
+        vpmovzxwd(vDst, addr);
+        uni_vpslld(vDst, vDst, 16);
+    } else {
+        uni_vmovups(vDst, addr);
+    }
+}
+
+template class SparseFcKernel<x64::avx512_core>;
+template class SparseFcKernel<x64::avx2>;
+
+}   // namespace intel_cpu
+}   // namespace ov
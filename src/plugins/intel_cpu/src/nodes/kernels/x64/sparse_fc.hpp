@@ -0,0 +1,105 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_kernel_base.hpp"
+#include "ie_precision.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * FullyConnected kernel for the structured sparse weights: the output channels are split into blocks of the vector
+ * length and the input channels into groups of 'groupSize' columns. For each channels block only the groups having
+ * non-zero weights are stored, and inside a group each output channel keeps 'slotsNum' values with their positions
+ * in the group. So the same kernel serves the N:M sparsity (2:4 - 2 slots of 4 columns, 4:8 - 4 slots of 8 columns)
+ * and the block sparsity (dense groups, slotsNum == groupSize, the zero blocks are skipped).
+ * The activations group is broadcast to the vector and permuted by the positions, so the weights are never unpacked.
+ */
+struct SparseFcKernelConfParams {
+    uint64_t groupSize = 4lu;
+    uint64_t slotsNum  = 2lu;
+    InferenceEngine::Precision wPrc = InferenceEngine::Precision::FP32;  // FP32 or BF16 values
+    bool withBias = false;
+};
+
+struct SparseFcKernelExecArgs {
+    const float* src;        // activations of the first row, [rowsNum, K]
+    const void* values;      // packed values of the channels block
+    const uint8_t* indices;  // positions of the values in their groups
+    const uint32_t* groups;  // byte offsets of the active groups in the activations row
+    const float* bias;       // vector length of the bias values
+    float* dst;              // output of the first row, vector length of the channels
+    uint64_t groupsNum  = 0lu;
+    uint64_t rowsNum    = 0lu;
+    uint64_t srcStrideB = 0lu;
+    uint64_t dstStrideB = 0lu;
+};
+
+class SparseFcKernelBase: public JitKernelBase {
+public:
+    void (*ker_)(const SparseFcKernelExecArgs *);
+    void operator()(const SparseFcKernelExecArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    explicit SparseFcKernelBase(const char* name, const SparseFcKernelConfParams& jcp) : JitKernelBase(name), ker_(nullptr), jcp(jcp) {}
+
+    virtual void create_ker() = 0;
+    // number of the output channels in a block
+    uint64_t getChannelsBlock() const {
+        return channelsBlock;
+    }
+
+protected:
+    SparseFcKernelConfParams jcp;
+    uint64_t channelsBlock = 16lu;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+class SparseFcKernel : public SparseFcKernelBase {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(SparseFcKernel)
+
+    explicit SparseFcKernel(const SparseFcKernelConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+protected:
+    std::string persistentCacheKey() const override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx512_core, Xbyak::Zmm, Xbyak::Ymm>::type;
+
+    // the weights of a group are loaded once for all the rows of the block
+    static constexpr uint64_t rowsBlock = isa == dnnl::impl::cpu::x64::avx512_core ? 8lu : 4lu;
+
+    const Xbyak::Reg64 regParams    = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+    const Xbyak::Reg64 regSrc       = r8;
+    const Xbyak::Reg64 regDst       = r9;
+    const Xbyak::Reg64 regRows      = r10;
+    const Xbyak::Reg64 regSrcStride = r11;
+    const Xbyak::Reg64 regDstStride = r12;
+    const Xbyak::Reg64 regValues    = r13;
+    const Xbyak::Reg64 regIndices   = r14;
+    const Xbyak::Reg64 regGroups    = r15;
+    const Xbyak::Reg64 regGroupsNum = rax;
+    const Xbyak::Reg64 regAux       = rbx;
+    const Xbyak::Reg64 regRow       = rdx;
+
+    Vmm vAcc(uint64_t row) const { return Vmm(row); }
+    Vmm vSrc(uint64_t row) const { return Vmm(rowsBlock + row); }
+    const Vmm vIdx = Vmm(2 * rowsBlock);
+    const Vmm vWei = Vmm(2 * rowsBlock + 1);
+    const Vmm vAux = Vmm(2 * rowsBlock + 2);
+
+    void rowsLoop(uint64_t rows);
+    void broadcastGroup(const Vmm& vDst, const Xbyak::Address& addr);
+    void loadValues(const Vmm& vDst, const Xbyak::Address& addr);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -416,6 +416,38 @@ static inline void parallel_step(size_t nDims, const VectorDims& dims, std::vect
     }
 }
 
+template <typename T>
+static inline void padInnerTyped(uint8_t* dst, const uint8_t* src, size_t count, ptrdiff_t srcStep) {
+    auto* dstTyped = reinterpret_cast<T*>(dst);
+    const auto* srcTyped = reinterpret_cast<const T*>(src);
+    for (size_t i = 0; i < count; ++i)
+        dstTyped[i] = srcTyped[static_cast<ptrdiff_t>(i) * srcStep];
+}
+
+// Fills count consecutive padded elements of elemSize bytes: dst[i] = src[i * srcStep], where srcStep is 0 for
+// the edge mode and -1 for the mirrored modes. Planar layouts pad single scalars, which are copied as typed values
+// in a loop the compiler vectorizes instead of issuing a memcpy call per element.
+static inline void padInner(uint8_t* dst, const uint8_t* src, size_t count, size_t elemSize, ptrdiff_t srcStep) {
+    switch (elemSize) {
+    case 1:
+        padInnerTyped<uint8_t>(dst, src, count, srcStep);
+        break;
+    case 2:
+        padInnerTyped<uint16_t>(dst, src, count, srcStep);
+        break;
+    case 4:
+        padInnerTyped<uint32_t>(dst, src, count, srcStep);
+        break;
+    case 8:
+        padInnerTyped<uint64_t>(dst, src, count, srcStep);
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i)
+            cpu_memcpy(dst + i * elemSize, src + static_cast<ptrdiff_t>(i) * srcStep * static_cast<ptrdiff_t>(elemSize), elemSize);
+        break;
+    }
+}
+
 void Pad::PadExecutor::padConstant(const MemoryPtr& srcMemPtr, const MemoryPtr& dstMemPtr) {
     if (params.attrs.padValue == 0 && !zeroInputDimsCase) {
         padConstantZero(srcMemPtr, dstMemPtr);
@@ -552,15 +584,13 @@ void Pad::PadExecutor::padEdge(const MemoryPtr& srcMemPtr, const MemoryPtr& dstM
             }
             srcIdx *= params.dataSize;
 
-            for (size_t i = 0; i < params.innerBeginPadCount; ++i)
-                cpu_memcpy(&dstData[dstIdx + i * params.shift], &srcData[srcIdx], params.shift);
+            padInner(&dstData[dstIdx], &srcData[srcIdx], params.innerBeginPadCount, params.shift, 0);
 
             cpu_memcpy(&dstData[dstIdx + params.innerBeginShift], &srcData[srcIdx + params.innerSrcShift], params.innerCopySize);
 
-            for (size_t i = 0; i < params.innerEndPadCount; ++i)
-                cpu_memcpy(&dstData[dstIdx + params.innerBeginShift + params.innerCopySize + i * params.shift],
-                           &srcData[srcIdx + (params.srcDims[params.nDimsForWork] - 1) * params.shift],
-                           params.shift);
+            padInner(&dstData[dstIdx + params.innerBeginShift + params.innerCopySize],
+                     &srcData[srcIdx + (params.srcDims[params.nDimsForWork] - 1) * params.shift],
+                     params.innerEndPadCount, params.shift, 0);
 
             parallel_step(params.nDimsForWork, params.dstDims, indexes);
         }
@@ -595,17 +625,15 @@ void Pad::PadExecutor::padReflectOrSymmetric(const MemoryPtr& srcMemPtr, const M
             }
             srcIdx *= params.dataSize;
 
-            for (size_t i = 0; i < params.innerBeginPadCount; ++i)
-                cpu_memcpy(&dstData[dstIdx + i * params.shift],
-                           &srcData[srcIdx + (params.attrs.padsBegin[params.nDimsForWork] - shift - i) * params.shift],
-                           params.shift);
+            padInner(&dstData[dstIdx],
+                     &srcData[srcIdx + (params.attrs.padsBegin[params.nDimsForWork] - shift) * params.shift],
+                     params.innerBeginPadCount, params.shift, -1);
 
             cpu_memcpy(&dstData[dstIdx + params.innerBeginShift], &srcData[srcIdx + params.innerSrcShift], params.innerCopySize);
 
-            for (size_t i = 0; i < params.innerEndPadCount; ++i)
-                cpu_memcpy(&dstData[dstIdx + (params.srcODims[params.nDimsForWork] + i) * params.shift],
-                           &srcData[srcIdx + endSrcShift - i * params.shift],
-                           params.shift);
+            padInner(&dstData[dstIdx + params.srcODims[params.nDimsForWork] * params.shift],
+                     &srcData[srcIdx + endSrcShift],
+                     params.innerEndPadCount, params.shift, -1);
 
             parallel_step(params.nDimsForWork, params.dstDims, indexes);
         }
@@ -9,6 +9,8 @@
 #include "nodes/common/cpu_convert.h"
 #include "utils/bfloat16.hpp"
 #include "input.h"
+#include "reorder.h"
+#include <ie_parallel.hpp>
 #include <dnnl_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
@@ -22,6 +24,9 @@
 #include <ngraph/node.hpp>
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <algorithm>
+#include <cstring>
+#include <map>
 #include <string>
 #include <utility>
 
@@ -276,53 +281,27 @@ bool RNN::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::s
         }
 
         ov::op::RecurrentSequenceDirection direction = ov::op::RecurrentSequenceDirection::FORWARD;
-        int64_t seqLenIdx = -1;
         if (auto gru_seq = ov::as_type_ptr<const ov::op::v5::GRUSequence>(op)) {
             direction = gru_seq->get_direction();
-            seqLenIdx = 2;
         } else if (auto lstm_seq = ov::as_type_ptr<const ov::op::v0::LSTMSequence>(op)) {
             if (lstm_seq->get_activations() != std::vector<std::string>{"sigmoid", "tanh", "tanh"}) {
                 errorMessage = "Not supported activation functions";
                 return false;
             }
             direction = lstm_seq->get_direction();
-            seqLenIdx = 3;
         } else if (auto lstm_seq = ov::as_type_ptr<const ov::op::v5::LSTMSequence>(op)) {
             direction = lstm_seq->get_direction();
-            seqLenIdx = 3;
         } else if (auto augru_seq = ov::as_type_ptr<const ov::op::internal::AUGRUSequence>(op)) {
             direction = augru_seq->get_direction();
-            seqLenIdx = 2;
         } else if (auto rnn_seq = ov::as_type_ptr<const ov::op::v5::RNNSequence>(op)) {
             direction = rnn_seq->get_direction();
-            seqLenIdx = 2;
         }
 
         if (!one_of(direction, ov::op::RecurrentSequenceDirection::FORWARD, ov::op::RecurrentSequenceDirection::REVERSE)) {
             errorMessage = "Unsupported sequence direction.";
             return false;
         }
-
-        if (seqLenIdx > 0) {
-            const auto& data_pshape = op->get_input_partial_shape(0);
-
-            // WA: dynamic shapes make impossible to check seq_len due to shapeOf subgraphs
-            // but the sequence is still supported in CPU and doesn't need to be decomposed
-            if (data_pshape.is_dynamic())
-                return true;
-
-            const int64_t maxSeqLenDimIdx = 1;
-
-            if (data_pshape.rank().is_static() && data_pshape.rank().get_length() > maxSeqLenDimIdx && !data_pshape[maxSeqLenDimIdx].is_static()) {
-                errorMessage = "Max sequence length dimension is dynamic";
-                return false;
-            }
-            auto maxSeqLen = data_pshape[maxSeqLenDimIdx].get_length();
-            if (ov::op::util::is_seq_len_provided(op->get_input_node_shared_ptr(seqLenIdx), maxSeqLen)) {
-                errorMessage = "Unsupported sequence length.";
-                return false;
-            }
-        }
+        // Note: the sequence lengths differing within the batch are supported, see RNN::executeVariableLengths()
     } catch (...) {
         return false;
     }
@@ -469,6 +448,10 @@ RNN::RNN(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context)
 
         nativeOrder = testNativeOrder(op);
 
+        const auto& dataShape = op->get_input_partial_shape(0);
+        const int64_t maxSeqLen = dataShape.rank().is_static() && dataShape[1].is_static() ? dataShape[1].get_length() : -1;
+        seqLengthsProvided = ov::op::util::is_seq_len_provided(op->get_input_node_shared_ptr(sIdx), maxSeqLen);
+
         initSequence();
     }
 
@@ -1075,57 +1058,46 @@ Node::AttrPtr RNN::initPrimitiveAttr() {
     return attr;
 }
 
-void RNN::prepareParams() {
-    for (size_t i = 0; i < wIdx; i++) {
-        auto memPtr = getParentEdgesAtPort(i).front()->getMemoryPtr();
-        if (!memPtr || !memPtr->isAllocated())
-            THROW_ERROR << "has uninitialized memory at port " << i;
+dnnl::memory::format_tag RNN::getWeightsFormat(size_t SL, size_t B) const {
+    // WA To avoid different weights layer and iter formats in FP32 case.
+    if (one_of(inDataTypes[xIdx], memory::data_type::f32) &&
+        (SL != 1 || B < optimalBatchSize)) {
+        return dnnl::memory::format_tag::ldigo;
     }
-    if ((is_cell && DC != getParentEdgesAtPort(0)[0]->getMemory().getDesc().getShape().getStaticDims()[1]) ||
-        (!is_cell && DC != getParentEdgesAtPort(0)[0]->getMemory().getDesc().getShape().getStaticDims()[2]))
-            THROW_ERROR << "has incorrect input size value in the first input.";
+    return dnnl::memory::format_tag::any;
+}
 
-    auto dataMemPtr = getParentEdgesAtPort(0).front()->getMemoryPtr();
-    const size_t B = dataMemPtr->getShape().getStaticDims()[0];
-    const size_t SL = is_cell ? 1lu : dataMemPtr->getShape().getStaticDims()[1];
+RNN::executorPtr RNN::getExecutor(size_t SL, size_t B) {
     const Shape shapeS_4D{L, D, B, SC};
 
-    inDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, DC}, inDataTypes[xIdx], memory::format_tag::tnc);
-    outDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, D * SC}, outDataTypes[yIdx], memory::format_tag::tnc);
+    std::vector<DnnlBlockedMemoryDescPtr> inDescs(inDataDescs.size());
+    std::vector<DnnlBlockedMemoryDescPtr> outDescs(outDataDescs.size());
+
+    inDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, DC}, inDataTypes[xIdx], memory::format_tag::tnc);
+    outDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, D * SC}, outDataTypes[yIdx], memory::format_tag::tnc);
 
-    inDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[hIdx], memory::format_tag::ldnc);
-    outDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[hoIdx], memory::format_tag::ldnc);
+    inDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[hIdx], memory::format_tag::ldnc);
+    outDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[hoIdx], memory::format_tag::ldnc);
 
     if (haveCellState(cell_type)) {
-        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[cIdx], memory::format_tag::ldnc);
-        outDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[coIdx], memory::format_tag::ldnc);
+        inDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[cIdx], memory::format_tag::ldnc);
+        outDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[coIdx], memory::format_tag::ldnc);
     } else if (haveAttention(cell_type)) {
-        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, 1}, inDataTypes[aIdx], memory::format_tag::tnc);
+        inDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, 1}, inDataTypes[aIdx], memory::format_tag::tnc);
     }
 
-    bool wFormatWasChanged = false;
-    // WA To avoid different weights layer and iter formats in FP32 case.
-    if (one_of(inDataTypes[xIdx], memory::data_type::f32) &&
-        (SL != 1 || B < optimalBatchSize)) {
-        if (wFormat != dnnl::memory::format_tag::ldigo) {
-            wFormat = dnnl::memory::format_tag::ldigo;
-            wFormatWasChanged = true;
-        }
-    } else if (wFormat != dnnl::memory::format_tag::any) {
-        wFormat = dnnl::memory::format_tag::any;
-        wFormatWasChanged = true;
-    }
-
-    if (wFormatWasChanged) {
-        auto weightsDims = DnnlExtensionUtils::convertToDnnlDims(VectorDims{ L, D, DC, G, SC });
-        const auto& targetWeightDataType = weightsByinputDataType.at(inDataTypes[xIdx]);
-        wDescs[0] = dnnl::memory::desc(weightsDims, targetWeightDataType, wFormat);
-        auto statesDims = DnnlExtensionUtils::convertToDnnlDims(VectorDims{ L, D, SC, G, SC });
-        wDescs[1] = dnnl::memory::desc(statesDims, targetWeightDataType, wFormat);
-    }
+    const auto weightsFormat = getWeightsFormat(SL, B);
+    const auto& targetWeightDataType = weightsByinputDataType.at(inDataTypes[xIdx]);
+    auto weightsDims = DnnlExtensionUtils::convertToDnnlDims(VectorDims{ L, D, DC, G, SC });
+    auto statesDims = DnnlExtensionUtils::convertToDnnlDims(VectorDims{ L, D, SC, G, SC });
+    const std::vector<dnnl::memory::desc> weightsDescs {
+        dnnl::memory::desc(weightsDims, targetWeightDataType, weightsFormat),
+        dnnl::memory::desc(statesDims, targetWeightDataType, weightsFormat),
+        wDescs[2]
+    };
 
     const auto attr = initPrimitiveAttr();
-    RNNKey key = { inDataDescs, outDataDescs, wDescs, cell_type, cell_act, direction, *attr };
+    RNNKey key = { inDescs, outDescs, weightsDescs, cell_type, cell_act, direction, *attr };
 
     auto engine = getEngine();
     auto builder = [&engine](const RNNKey& key) -> executorPtr {
@@ -1142,9 +1114,25 @@ void RNN::prepareParams() {
     };
 
     auto cache = context->getParamsCache();
-    auto result = cache->getOrCreate(key, builder);
+    return cache->getOrCreate(key, builder).first;
+}
+
+void RNN::prepareParams() {
+    for (size_t i = 0; i < wIdx; i++) {
+        auto memPtr = getParentEdgesAtPort(i).front()->getMemoryPtr();
+        if (!memPtr || !memPtr->isAllocated())
+            THROW_ERROR << "has uninitialized memory at port " << i;
+    }
+    if ((is_cell && DC != getParentEdgesAtPort(0)[0]->getMemory().getDesc().getShape().getStaticDims()[1]) ||
+        (!is_cell && DC != getParentEdgesAtPort(0)[0]->getMemory().getDesc().getShape().getStaticDims()[2]))
+            THROW_ERROR << "has incorrect input size value in the first input.";
+
+    auto dataMemPtr = getParentEdgesAtPort(0).front()->getMemoryPtr();
+    const size_t B = dataMemPtr->getShape().getStaticDims()[0];
+    const size_t SL = is_cell ? 1lu : dataMemPtr->getShape().getStaticDims()[1];
+
     auto prevExecPtr = execPtr;
-    execPtr = result.first;
+    execPtr = getExecutor(SL, B);
 
     if (!execPtr) {
         IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
@@ -1186,10 +1174,24 @@ void RNN::execute(dnnl::stream strm) {
     if (!execPtr)
         THROW_ERROR << "does not have initialized primitive to execute.";
 
+    if (seqLengthsProvided) {
+        const auto& dataDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+        const auto* seqLengths = reinterpret_cast<const int32_t*>(getParentEdgeAt(sIdx)->getMemoryPtr()->getData());
+        if (std::any_of(seqLengths, seqLengths + dataDims[0],
+                        [&](int32_t len) { return static_cast<size_t>(len) != dataDims[1]; })) {
+            executeVariableLengths(strm, seqLengths);
+            return;
+        }
+    }
+
     const auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
     const auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
 
     auto args = primArgs;
+    if (seqLengthsProvided) {
+        // the scratchpad could be reallocated for the variable length groups
+        args[DNNL_ARG_SCRATCHPAD] = getScratchPadMem(execPtr->getScratchPadDesc())->getPrimitive();
+    }
 
     args[DNNL_ARG_SRC_LAYER] = src_data_mem->getPrimitive();
     args[DNNL_ARG_DST_LAYER] = dst_data_mem->getPrimitive();
@@ -1220,6 +1222,137 @@ void RNN::execute(dnnl::stream strm) {
     execPtr->exec(args, strm);
 }
 
+MemoryPtr RNN::getWeightsMemory(const DnnlMemoryDescPtr& desc, size_t idx) {
+    if (internalBlobMemory[idx]->getDesc().isCompatible(*desc))
+        return internalBlobMemory[idx];
+    for (const auto& mem : weightsVariants) {
+        if (mem->getDesc().isCompatible(*desc))
+            return mem;
+    }
+    // the primitive of the other shape prefers a different weights layout
+    auto mem = std::make_shared<Memory>(getEngine(), desc);
+    node::Reorder::reorderData(*internalBlobMemory[idx], *mem, context->getParamsCache());
+    weightsVariants.push_back(mem);
+    return mem;
+}
+
+void RNN::executeVariableLengths(dnnl::stream strm, const int32_t* seqLengths) {
+    // oneDNN does not support the sequence length per batch, so the batch is split into the groups of the sequences
+    // with equal lengths, and each group is executed for its own length only, without computing the padding.
+    // All the memory has [T, N, C] physical layout.
+    const auto& dataDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const size_t B = dataDims[0];
+    const size_t SL = dataDims[1];
+
+    std::map<size_t, std::vector<size_t>, std::greater<size_t>> groups;
+    for (size_t b = 0; b < B; b++) {
+        const auto len = static_cast<size_t>(std::max(0, seqLengths[b]));
+        groups[std::min(len, SL)].push_back(b);
+    }
+
+    const size_t xRow = DC * DnnlExtensionUtils::sizeOfDataType(inDataTypes[xIdx]);
+    const size_t yRow = D * SC * DnnlExtensionUtils::sizeOfDataType(outDataTypes[yIdx]);
+    const size_t aRow = haveAttention(cell_type) ? DnnlExtensionUtils::sizeOfDataType(inDataTypes[aIdx]) : 0;
+    std::vector<size_t> sRow(S);
+    for (size_t s = 0; s < S; s++)
+        sRow[s] = SC * DnnlExtensionUtils::sizeOfDataType(inDataTypes[hIdx + s]);
+
+    const auto* src = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->getData());
+    auto* dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->getData());
+    const auto* attention = haveAttention(cell_type) ?
+        reinterpret_cast<const uint8_t*>(getParentEdgeAt(aIdx)->getMemoryPtr()->getData()) : nullptr;
+    std::vector<const uint8_t*> srcStates(S);
+    std::vector<uint8_t*> dstStates(S, nullptr);
+    const size_t nOutStates = std::min(S, outputShapes.size() - 1);
+    for (size_t s = 0; s < S; s++) {
+        srcStates[s] = reinterpret_cast<const uint8_t*>(getParentEdgeAt(s + 1)->getMemoryPtr()->getData());
+        if (s < nOutStates)
+            dstStates[s] = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(s + 1)[0]->getMemoryPtr()->getData());
+    }
+
+    // the output values beyond the sequence length are zeros
+    std::memset(dst, 0, SL * B * yRow);
+
+    int state_i_tags[] {DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C};
+    int state_o_tags[] {DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C};
+
+    for (const auto& group : groups) {
+        const size_t len = group.first;
+        const auto& ids = group.second;
+        const size_t n = ids.size();
+
+        if (len == 0) {
+            // the states pass through the empty sequences unchanged
+            for (size_t s = 0; s < nOutStates; s++) {
+                for (auto b : ids)
+                    cpu_memcpy(dstStates[s] + b * sRow[s], srcStates[s] + b * sRow[s], sRow[s]);
+            }
+            continue;
+        }
+
+        auto executor = getExecutor(len, n);
+        if (!executor)
+            THROW_ERROR << "can't create primitive for the sequence length " << len;
+
+        // stage the group data contiguously: X, Y, attention, input states, output states
+        const size_t xSize = len * n * xRow, ySize = len * n * yRow, aSize = len * n * aRow;
+        size_t statesSize = 0;
+        for (size_t s = 0; s < S; s++)
+            statesSize += 2 * n * sRow[s];
+        varLenBuffer.resize(xSize + ySize + aSize + statesSize);
+        auto* xBuf = varLenBuffer.data();
+        auto* yBuf = xBuf + xSize;
+        auto* aBuf = yBuf + ySize;
+        auto* stateBuf = aBuf + aSize;
+
+        parallel_for(len, [&](size_t t) {
+            for (size_t i = 0; i < n; i++) {
+                cpu_memcpy(xBuf + (t * n + i) * xRow, src + (t * B + ids[i]) * xRow, xRow);
+                if (aRow)
+                    cpu_memcpy(aBuf + (t * n + i) * aRow, attention + (t * B + ids[i]) * aRow, aRow);
+            }
+        });
+
+        // the group primitive is created for the plain layouts, see getExecutor()
+        auto plainMemory = [&](const VectorDims& dims, memory::data_type type, memory::format_tag tag, void* data) {
+            return dnnl::memory(dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(dims), type, tag), getEngine(), data);
+        };
+
+        auto args = primArgs;
+        args[DNNL_ARG_SRC_LAYER] = plainMemory({len, n, DC}, inDataTypes[xIdx], memory::format_tag::tnc, xBuf);
+        args[DNNL_ARG_DST_LAYER] = plainMemory({len, n, D * SC}, outDataTypes[yIdx], memory::format_tag::tnc, yBuf);
+        if (aRow)
+            args[DNNL_ARG_AUGRU_ATTENTION] = plainMemory({len, n, 1}, inDataTypes[aIdx], memory::format_tag::tnc, aBuf);
+
+        std::vector<uint8_t*> dstStateBufs(S);
+        for (size_t s = 0; s < S; s++) {
+            auto* srcStateBuf = stateBuf;
+            dstStateBufs[s] = stateBuf + n * sRow[s];
+            stateBuf += 2 * n * sRow[s];
+            for (size_t i = 0; i < n; i++)
+                cpu_memcpy(srcStateBuf + i * sRow[s], srcStates[s] + ids[i] * sRow[s], sRow[s]);
+            args[state_i_tags[s]] = plainMemory({L, D, n, SC}, inDataTypes[hIdx + s], memory::format_tag::ldnc, srcStateBuf);
+            args[state_o_tags[s]] = plainMemory({L, D, n, SC}, outDataTypes[hoIdx + s], memory::format_tag::ldnc, dstStateBufs[s]);
+        }
+
+        args[DNNL_ARG_WEIGHTS_LAYER] = getWeightsMemory(executor->getWeightDesc(), 0)->getPrimitive();
+        args[DNNL_ARG_WEIGHTS_ITER] = getWeightsMemory(executor->getWeightIterDesc(), 1)->getPrimitive();
+        args[DNNL_ARG_BIAS] = getWeightsMemory(executor->getBiasDesc(), 2)->getPrimitive();
+        args[DNNL_ARG_SCRATCHPAD] = getScratchPadMem(executor->getScratchPadDesc())->getPrimitive();
+
+        executor->exec(args, strm);
+
+        parallel_for(len, [&](size_t t) {
+            for (size_t i = 0; i < n; i++)
+                cpu_memcpy(dst + (t * B + ids[i]) * yRow, yBuf + (t * n + i) * yRow, yRow);
+        });
+        for (size_t s = 0; s < nOutStates; s++) {
+            for (size_t i = 0; i < n; i++)
+                cpu_memcpy(dstStates[s] + ids[i] * sRow[s], dstStateBufs[s] + i * sRow[s], sRow[s]);
+        }
+    }
+}
+
 void RNN::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
@@ -68,6 +68,9 @@ private:
 
     void copyWeightsData();
 
+    void executeVariableLengths(dnnl::stream strm, const int32_t* seqLengths);
+    MemoryPtr getWeightsMemory(const DnnlMemoryDescPtr& desc, size_t idx);
+
     class RnnDnnlExecutor : public DnnlExecutor {
         public:
             RnnDnnlExecutor(const dnnl::primitive_desc& pd);
@@ -88,6 +91,9 @@ private:
     using executorPtr = std::shared_ptr<RnnDnnlExecutor>;
     executorPtr execPtr = nullptr;
 
+    dnnl::memory::format_tag getWeightsFormat(size_t SL, size_t B) const;
+    executorPtr getExecutor(size_t SL, size_t B);
+
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
 
@@ -96,6 +102,12 @@ private:
     /** Native order if [batch, seq, data], other case is [seq, batch, data] */
     bool nativeOrder = true;
 
+    /** The sequence lengths may differ within the batch, checked on each execution */
+    bool seqLengthsProvided = false;
+    /** Weights reordered for the primitives of the variable length groups */
+    std::vector<MemoryPtr> weightsVariants;
+    std::vector<uint8_t> varLenBuffer;
+
     /** Direction of iteration through sequence dimension */
     dnnl::rnn_direction direction = dnnl::rnn_direction::unidirectional_left2right;
 
@@ -10,6 +10,7 @@
 #include "ie_parallel.hpp"
 #include <algorithm>
 #include "common/cpu_memcpy.h"
+#include "common/indexed_copy.h"
 
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
@@ -371,11 +372,9 @@ void ScatterUpdate::execute(dnnl::stream strm) {
 void ScatterUpdate::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
     const auto& srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
     const auto& indicesDim = getParentEdgeAt(INDICES_ID)->getMemory().getStaticDims();
-    const auto& updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
     size_t indicesRank = indicesDim.size();
 
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
-    std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
     const size_t mulIdentity = 1;
     size_t idxLength = mulIdentity;
@@ -390,12 +389,14 @@ void ScatterUpdate::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, u
     size_t blockToUpdate = srcBlockND[axis + 1];
     size_t blockToUpdateSize = blockToUpdate * dataSize;
 
+    // update blocks are dense: updateBlockND[axis] == idxLength * blockToUpdate, so update block b * idxLength + idx
+    // is the one applied at (b, indices[idx])
+    dstOffsets.resize(batchToUpdate * idxLength);
     parallel_for2d(batchToUpdate, idxLength, [&](size_t b, size_t idx) {
         int64_t idxValue = getIndicesValue(indices, idx);
-        uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
-        uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
-        cpu_memcpy(dstEntry, updateEntry, blockToUpdateSize);
+        dstOffsets[b * idxLength + idx] = (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
     });
+    scatterRuns(dstData, update, blockToUpdateSize, srcBlockND[0] * dataSize, dstOffsets, scatterBuffers);
 }
 
 // indices is a (q-1)-dimension tensor of k-tuple,
@@ -415,6 +416,7 @@ void ScatterUpdate::scatterNDUpdate(uint8_t *indices, uint8_t *update, uint8_t *
     }
 
     size_t sizeToUpdate = srcBlockND[k] * dataSize;
+    dstOffsets.resize(idxTupleNum);
     parallel_for(idxTupleNum, [&](size_t tupleIdx) {
         size_t indicesOffset = tupleIdx * k;
         size_t dstOffset = 0;
@@ -426,10 +428,9 @@ void ScatterUpdate::scatterNDUpdate(uint8_t *indices, uint8_t *update, uint8_t *
             }
             dstOffset += idxValue * srcBlockND[i + 1];
         }
-        dstOffset *= dataSize;
-        size_t updateOffset = tupleIdx * sizeToUpdate;
-        cpu_memcpy(dstData + dstOffset, update + updateOffset, sizeToUpdate);
+        dstOffsets[tupleIdx] = dstOffset * dataSize;
     });
+    scatterRuns(dstData, update, sizeToUpdate, srcBlockND[0] * dataSize, dstOffsets, scatterBuffers);
 }
 
 // output[indices[i][j][k]][j][k] = updates[i][j][k] if axis = 0,
@@ -441,46 +442,67 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
     size_t updateRank = updateDim.size();
 
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
-    std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        int j;
-        size_t i, dst_idx = 0, start = 0, end = 0;
-        SizeVector tensorItr(updateRank, 0);
-        splitter(updateBlockND[0], nthr, ithr, start, end);
-        for (j = updateRank - 1, i = start; j >= 0; j--) {
-            tensorItr[j] = i % updateDim[j];
-            i /= updateDim[j];
+    // Updates sharing all the coordinates except the axis one form a line, and only updates of the same line
+    // may hit the same output element. Lines are distributed between threads and every line is applied in order,
+    // so the scatter is conflict-free and duplicated indices resolve to the last update.
+    const size_t axisDim = updateDim[axis];
+    size_t outerNum = 1, innerNum = 1;
+    for (int d = 0; d < axis; d++)
+        outerNum *= updateDim[d];
+    for (size_t d = axis + 1; d < updateRank; d++)
+        innerNum *= updateDim[d];
+
+    // destination offsets of the coordinates before and after the axis
+    std::vector<size_t> outerDst(outerNum, 0), innerDst(innerNum, 0);
+    for (size_t o = 0; o < outerNum; o++) {
+        size_t i = o;
+        for (int d = axis - 1; d >= 0; d--) {
+            outerDst[o] += (i % updateDim[d]) * srcBlockND[d + 1];
+            i /= updateDim[d];
         }
+    }
+    for (size_t in = 0; in < innerNum; in++) {
+        size_t i = in;
+        for (int d = static_cast<int>(updateRank) - 1; d > axis; d--) {
+            innerDst[in] += (i % updateDim[d]) * srcBlockND[d + 1];
+            i /= updateDim[d];
+        }
+    }
 
-        for (i = 0; i < static_cast<size_t>(axis); ++i)
-            dst_idx += tensorItr[i] * srcBlockND[i + 1];
-        for (i++; i < updateRank; ++i)
-            dst_idx += tensorItr[i] * srcBlockND[i + 1];
-
-        for (size_t iwork = start; iwork < end; iwork++) {
-            int64_t idxValue = getIndicesValue(indices, iwork);
-            int64_t axisDim = static_cast<int64_t>(srcDataDim[axis]);
-            if (idxValue < 0)
-                idxValue += axisDim;
-            if (0 <= idxValue && idxValue < axisDim)
-                cpu_memcpy(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
-                            update + iwork * dataSize, dataSize);
-
-            for (j = updateRank - 1; j >= 0; j--) {
-                tensorItr[j]++;
-                if (tensorItr[j] < updateDim[j]) {
-                    if (j != axis)
-                        dst_idx += srcBlockND[j + 1];
-                    break;
-                } else {
-                    tensorItr[j] = 0;
-                    for (dst_idx = 0, i = 0; i < static_cast<size_t>(axis); ++i)
-                        dst_idx += tensorItr[i] * srcBlockND[i + 1];
-                    for (i++; i < updateRank; ++i)
-                        dst_idx += tensorItr[i] * srcBlockND[i + 1];
+    const int64_t srcAxisDim = static_cast<int64_t>(srcDataDim[axis]);
+    const size_t axisStride = srcBlockND[axis + 1];
+    auto copyElement = [&](uint8_t* dst, const uint8_t* src) {
+        switch (dataSize) {
+            case 4: *reinterpret_cast<int32_t*>(dst) = *reinterpret_cast<const int32_t*>(src); break;
+            case 2: *reinterpret_cast<int16_t*>(dst) = *reinterpret_cast<const int16_t*>(src); break;
+            case 1: *dst = *src; break;
+            default: cpu_memcpy(dst, src, dataSize);
+        }
+    };
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(outerNum * innerNum, nthr, ithr, start, end);
+        // the range is processed in segments of lines with the same outer coordinates, inner coordinates are the
+        // fastest changing ones, so indices and updates are read contiguously
+        for (size_t w = start; w < end;) {
+            const size_t o = w / innerNum;
+            const size_t inStart = w % innerNum;
+            const size_t inEnd = std::min(innerNum, inStart + (end - w));
+            const size_t lineBase = o * axisDim * innerNum;
+            for (size_t a = 0; a < axisDim; a++) {
+                for (size_t in = inStart; in < inEnd; in++) {
+                    const size_t u = lineBase + a * innerNum + in;
+                    int64_t idxValue = getIndicesValue(indices, u);
+                    if (idxValue < 0)
+                        idxValue += srcAxisDim;
+                    if (0 <= idxValue && idxValue < srcAxisDim)
+                        copyElement(dstData + dataSize * (outerDst[o] + idxValue * axisStride + innerDst[in]),
+                                    update + u * dataSize);
                 }
             }
+            w += inEnd - inStart;
         }
     });
 }
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "common/indexed_copy.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -52,6 +53,10 @@ private:
     size_t dataSize, indicesSize, axisSize;
     InferenceEngine::Precision dataPrec, indicesPrec, axisPrec;
 
+    // destination offsets of the update blocks and the scatter buckets, reused between executions
+    std::vector<size_t> dstOffsets;
+    ScatterRunsBuffers scatterBuffers;
+
     std::string errorPrefix;
 };
 
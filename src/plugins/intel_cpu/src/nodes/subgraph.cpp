@@ -24,6 +24,9 @@
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "utils/cpu_utils.hpp"
 #include "emitters/x64/cpu_generator.hpp"
+#include "nodes/kernels/x64/jit_kernel_base.hpp"
+#include "transformations/hash.hpp"
+#include "utils/debug_capabilities.h"
 #include "transformations/snippets/x64/pass/lowered/fuse_load_store_and_convert.hpp"
 #include "transformations/snippets/x64/pass/lowered/brgemm_blocking.hpp"
 #include "transformations/snippets/x64/pass/mul_add_to_fma.hpp"
@@ -74,6 +77,22 @@ public:
 private:
     Snippet* m_node;
 };
+
+// Holds the snippet code loaded from the persistent kernel cache
+class SnippetCodeImage : public dnnl::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(SnippetCodeImage)
+
+    explicit SnippetCodeImage(KernelDiskCache::Image image) : jit_generator(jit_name()), image(std::move(image)) {}
+
+    void generate() override {
+        JitKernelBase::emitCodeImage(*this, image);
+    }
+
+private:
+    const KernelDiskCache::Image image;
+};
+
 } // namespace
 
 Snippet::Snippet(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context)
@@ -84,6 +103,8 @@ Snippet::Snippet(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr c
     if (!original_snippet) {
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
     }
+    // shapeInfer() updates master shape and reshapes the body
+    disableShapeInferMemoization();
 }
 
 void Snippet::copy_snippet() {
@@ -384,7 +405,6 @@ void Snippet::createPrimitive() {
     jcp.master_shape = masterShape;
     jcp.tile_rank = tileRank;
     generate(&jcp);
-    buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
 }
 
@@ -549,6 +569,10 @@ bool Snippet::created() const {
 }
 
 void Snippet::generate(const jit_snippets_compile_args* jcp) {
+    const auto key = context->getKernelCache() ? persistentCacheKey() : std::string{};
+    if (!key.empty() && loadFromKernelCache(key))
+        return;
+
     ov::pass::Manager pre_dialect;
     pre_dialect.register_pass<ConvertToSwishCPU>();
     if (context->getConfig().inferencePrecision == ov::element::bf16 && snippet->has_domain_sensitive_ops()) {
@@ -580,6 +604,82 @@ void Snippet::generate(const jit_snippets_compile_args* jcp) {
         control_flow_markup_pipeline,
         control_flow_pipeline,
         reinterpret_cast<const void*>(jcp));
+    buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
+
+    if (!key.empty())
+        storeToKernelCache(key);
+}
+
+std::string Snippet::persistentCacheKey() const {
+    // the body is already reshaped to the normalized shapes, so together with the scheduling parameters
+    // and the memory formats it defines the generated code
+    uint64_t bodyHash = 0;
+    try {
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::Hash>(bodyHash);
+        manager.run_passes(snippet->body_ptr());
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Snippet ", getName(), " is not cached, can't hash the body: ", e.what());
+        return {};
+    }
+
+    std::ostringstream key;
+    key << "Snippet|body=" << bodyHash << "|isa=" << host_isa
+        << "|bf16=" << (context->getConfig().inferencePrecision == ov::element::bf16)
+        << "|tile=" << tileRank << "|master=" << Shape(masterShape).toString();
+    const auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    for (const auto& inConf : config.inConfs)
+        key << "|in=" << inConf.getMemDesc()->getPrecision().name() << inConf.getMemDesc()->serializeFormat();
+    for (const auto& outConf : config.outConfs)
+        key << "|out=" << outConf.getMemDesc()->getPrecision().name() << outConf.getMemDesc()->serializeFormat();
+    return key.str();
+}
+
+bool Snippet::loadFromKernelCache(const std::string& key) {
+    KernelDiskCache::Image image;
+    if (!context->getKernelCache()->load(key, image))
+        return false;
+
+    // metadata: is_flat, buffer scratchpad size, work size rank and dims
+    std::istringstream metadata(image.metadata);
+    bool isFlat = false;
+    size_t scratchpadSize = 0, rank = 0;
+    metadata >> isFlat >> scratchpadSize >> rank;
+    std::vector<Dimension> workSize(rank);
+    for (auto& d : workSize) {
+        int64_t dim = 0;
+        metadata >> dim;
+        d = dim;
+    }
+    if (metadata.fail())
+        return false;
+
+    std::unique_ptr<SnippetCodeImage> code(new SnippetCodeImage(std::move(image)));
+    if (code->create_kernel() != dnnl::impl::status::success)
+        return false;
+
+    schedule = snippets::Schedule(ov::PartialShape(workSize), isFlat, code->jit_ker());
+    buffer_scratchpad_size = scratchpadSize;
+    cachedCode = std::move(code);
+    return true;
+}
+
+void Snippet::storeToKernelCache(const std::string& key) const {
+    const auto targetMachine = std::dynamic_pointer_cast<const CPUTargetMachine>(
+        snippet->get_generator()->get_target_machine());
+    if (!targetMachine || !schedule.ptr || schedule.work_size.is_dynamic())
+        return;
+
+    KernelDiskCache::Image image;
+    if (!KernelDiskCache::makeImage(schedule.ptr, targetMachine->get_snippet_size(), image))
+        return;
+
+    std::ostringstream metadata;
+    metadata << schedule.is_flat << " " << buffer_scratchpad_size << " " << schedule.work_size.size();
+    for (const auto& d : schedule.work_size)
+        metadata << " " << d.get_length();
+    image.metadata = metadata.str();
+    context->getKernelCache()->store(key, image);
 }
 
 void Snippet::update_ptrs(jit_snippets_call_args& call_args) {
@@ -63,6 +63,10 @@ private:
     bool optimizeExecDomain(std::vector<VectorDims>&, std::vector<VectorDims>&, VectorDims&, size_t&) const;
 
     void generate(const jit_snippets_compile_args*);
+    // returns the persistent kernel cache key of the snippet, empty if the snippet can't be cached
+    std::string persistentCacheKey() const;
+    bool loadFromKernelCache(const std::string& key);
+    void storeToKernelCache(const std::string& key) const;
     inline void update_ptrs(jit_snippets_call_args&);
     // Evaluates generated snippet using parallel backend
     void schedule_6d();
@@ -75,6 +79,8 @@ private:
 
     // Holds generated snippet with information about how to schedule it
     snippets::Schedule schedule;
+    // Holds the code of the snippet loaded from the persistent kernel cache
+    std::unique_ptr<dnnl::impl::cpu::x64::jit_generator> cachedCode;
 
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
@@ -4,6 +4,8 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -78,6 +80,45 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// the chunks along the axis are contiguous in a dense planar tensor when all the outer dimensions are 1
+static bool canBindToChunk(const MemoryPtr& full, const MemoryPtr& part, const int axis) {
+    auto isDensePlain = [](const MemoryPtr& mem) {
+        const auto& desc = mem->getDesc();
+        return desc.hasLayoutType(LayoutType::ncsp) &&
+               mem->getSize() == desc.getShape().getElementsCount() * desc.getPrecision().size();
+    };
+    const auto& full_dims = full->getStaticDims();
+    return isDensePlain(full) && isDensePlain(part) && full->getDesc().getPrecision() == part->getDesc().getPrecision() &&
+           std::all_of(full_dims.begin(), full_dims.begin() + axis, [](size_t dim) { return dim == 1; });
+}
+
+// the body input memory may be rebound when it is not a view on the memory of the consumers,
+// an external memory may be bound only when the body doesn't modify it
+static bool canRebindBodyInput(const NodePtr& input, const bool modifiable) {
+    for (auto& edge : input->getChildEdgesAtPort(0)) {
+        const auto& child = edge->getChild();
+        if (child->isConstant() || edge->inPlace(Edge::LOOK_DOWN) ||
+            (child->getType() == Type::Concatenation && child->isInPlace()))
+            return false;
+        if (!modifiable && edge->modifiedInPlace())
+            return false;
+    }
+    return true;
+}
+
+// the body output memory may be rebound when it is not a view on the memory of another tensor
+static bool canRebindBodyOutput(const NodePtr& output) {
+    const auto edge = output->getParentEdgeAt(0);
+    const auto& parent = edge->getParent();
+    if (parent->getType() == Type::Input || parent->isConstant() || parent->isInPlace())
+        return false;
+    for (auto& child_edge : parent->getChildEdgesAtPort(edge->getInputNum())) {
+        if (child_edge->inPlace(Edge::LOOK_DOWN))
+            return false;
+    }
+    return true;
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -160,6 +201,66 @@ public:
     }
 };
 
+/**
+ * Exchanges the buffers of the body output and the body input instead of copying the data between iterations.
+ * Both memories must own an exclusive buffer of the same layout, so the exchange is invisible to the body.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const MemoryPtr &to) : from(from), to(to) {}
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            auto from_mngr = from->getMemoryMngr();
+            auto to_mngr = to->getMemoryMngr();
+            auto from_ptr = from_mngr->getRawPtr();
+            auto to_ptr = to_mngr->getRawPtr();
+            const auto size = from->getSize();
+            to_mngr->setExtBuff(from_ptr, size);
+            from_mngr->setExtBuff(to_ptr, size);
+        }
+    }
+
+private:
+    MemoryPtr from;
+    MemoryPtr to;
+};
+
+/**
+ * Binds the body port memory to the chunk of the external tensor instead of copying the chunk.
+ * Applied before the iteration for both the sliced inputs and the concatenated outputs, so the body reads from or
+ * writes to the external tensor directly.
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MemoryPtr &full, const MemoryPtr &part, const PortMap &slice_rule) : full(full), part(part) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        iter_count = full->getStaticDims()[slice_rule.axis] / abs_stride;
+
+        chunk_size_in_byte = static_cast<ptrdiff_t>(part->getSize());
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_size_in_byte : 0;
+        chunk_stride_in_byte = slice_rule.stride < 0 ? -chunk_size_in_byte : chunk_size_in_byte;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        // the external memory may be changed between the inferences, so the pointer is not cached
+        auto chunk_ptr = static_cast<uint8_t *>(full->getData()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        part->getMemoryMngr()->setExtBuff(chunk_ptr, static_cast<size_t>(chunk_size_in_byte));
+    }
+
+private:
+    MemoryPtr full;
+    MemoryPtr part;
+
+    ptrdiff_t chunk_size_in_byte = 0;
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    int iter_count;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MemoryPtr &to, const dnnl::engine& eng) {
@@ -263,7 +364,9 @@ void DynamicBuffer::init(const dnnl::engine& eng) {
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
     chunk_unit_in_byte = abs_stride * len;
 
-    if (!mem_holder_buffer) { // else reuse buffer holder of last inference
+    // reuse buffer holder of last inference unless it is known to be too small for the whole loop,
+    // then the buffer is replaced before any data is written rather than being grown on the way
+    if (!mem_holder_buffer || (max_iter_count != -1 && get_capacity() < static_cast<size_t>(max_iter_count))) {
         // preallocate a large chunk of memory to hold intermediate concated outputs of all iterations.
         mem_holder_buffer = create_buffer(eng);
     }
@@ -274,6 +377,12 @@ void DynamicBuffer::init(const dnnl::engine& eng) {
     num_execs = 0;
 }
 
+size_t DynamicBuffer::get_capacity() const {
+    // number of iterations the buffer holder is able to store for the current chunk geometry
+    const auto iter_size_in_byte = count * chunk_unit_in_byte;
+    return iter_size_in_byte ? mem_holder_buffer->getSize() / iter_size_in_byte : std::numeric_limits<size_t>::max();
+}
+
 bool DynamicBuffer::check_buffer() {
     if (map_rule.stride > 0) {
         if (static_cast<ptrdiff_t>(chunk_offset_in_byte + chunk_unit_in_byte) > chunk_stride_in_byte) return true;
@@ -415,6 +524,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -426,6 +536,7 @@ void TensorIterator::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_nodes.push_back(outNode->second);
         }
     }
 
@@ -639,6 +750,9 @@ void TensorIterator::prepareInputPorts() {
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (!isDynamicNode() && canBindToChunk(from_mem, to_mem, map_rule.axis) &&
+                 canRebindBodyInput(input_nodes[map_rule.to], false) && isExclusiveBodyMemory(to_mem))
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(from_mem, to_mem, map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -651,8 +765,20 @@ void TensorIterator::prepareOutputPorts() {
         auto to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
+        // the body output is written directly to the chunk of the output tensor unless it is needed elsewhere
+        const auto isSingleUse = [&](int body_output_idx) {
+            return body_output_idx != loopBodyConditionOutputIdx &&
+                   std::count_if(outputPortMap.begin(), outputPortMap.end(),
+                                 [&](const PortMap& rule) { return rule.to == body_output_idx; }) == 1 &&
+                   std::none_of(backEdges.begin(), backEdges.end(),
+                                [&](const PortMap& rule) { return rule.from == body_output_idx; });
+        };
+
         if (map_rule.axis == -1)
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (isSingleUse(map_rule.to) && canBindToChunk(to_mem, from_mem, map_rule.axis) &&
+                 canRebindBodyOutput(output_nodes[map_rule.to]) && isExclusiveBodyMemory(from_mem))
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(to_mem, from_mem, map_rule));
         else
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
     }
@@ -664,10 +790,36 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        // ping-pong: the body output of an iteration becomes the body input of the next one by exchanging the buffers
+        const bool canSwap = std::count_if(backEdges.begin(), backEdges.end(),
+                                           [&](const PortMap& rule) { return rule.from == map_rule.from; }) == 1 &&
+                             from_mem->getDesc().isCompatible(to_mem->getDesc()) &&
+                             from_mem->getSize() == to_mem->getSize() &&
+                             isExclusiveBodyMemory(from_mem) && isExclusiveBodyMemory(to_mem) &&
+                             canRebindBodyOutput(output_nodes[map_rule.from]) &&
+                             canRebindBodyInput(input_nodes[map_rule.to], true);
+
+        if (canSwap)
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, to_mem));
+        else
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
     }
 }
 
+bool TensorIterator::isExclusiveBodyMemory(const MemoryPtr& mem) const {
+    const auto mngr = mem->getMemoryMngr();
+    size_t count = std::count_if(output_mem.begin(), output_mem.end(), [&](const MemoryPtr& other) {
+        return other->getMemoryMngr() == mngr;
+    });
+    // all the consumers of a body input share the memory
+    count += std::count_if(input_mems.begin(), input_mems.end(), [&](const std::vector<MemoryPtr>& mems) {
+        return std::any_of(mems.begin(), mems.end(), [&](const MemoryPtr& other) {
+            return other->getMemoryMngr() == mngr;
+        });
+    });
+    return count == 1;
+}
+
 void TensorIterator::prepareDynamicBackEdges() {
     const auto &eng = getEngine();
     back_mappers.clear();
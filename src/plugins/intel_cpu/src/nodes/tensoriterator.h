@@ -75,6 +75,7 @@ private:
     void init(const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
+    size_t get_capacity() const;
     bool check_buffer();
     MemoryPtr create_buffer(const dnnl::engine& eng);
     void move_buffer(const MemoryPtr& new_buffer);
@@ -133,6 +134,9 @@ private:
     void prepareInitialCond();
     void prepareTripCount();
 
+    /* Returns true if no other body port shares the memory, so it may be rebound */
+    bool isExclusiveBodyMemory(const MemoryPtr& mem) const;
+
     /* Dynamic support */
     void reshapeSubgraphInput();
     void reshapeAndFillOutput(dnnl::stream strm);
@@ -143,6 +147,8 @@ private:
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<NodePtr> input_nodes;
+    std::vector<NodePtr> output_nodes;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -0,0 +1,264 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "token_sampling.h"
+#include "ie_parallel.hpp"
+#include "transformations/cpu_opset/common/op/token_sampling.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+class TokenSamplingShapeInfer : public ShapeInferEmptyPads {
+public:
+    TokenSamplingShapeInfer(const size_t k) : m_k(k) {}
+    Result infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        auto output_shape = input_shapes[0].get();
+        output_shape.back() = m_k;
+        return {{output_shape, output_shape}, ShapeInferStatus::success};
+    }
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    size_t m_k;
+};
+
+class TokenSamplingShapeInferFactory : public ShapeInferFactory {
+public:
+    TokenSamplingShapeInferFactory(const std::shared_ptr<ov::Node>& op) : m_op(op) {}
+    ShapeInferPtr makeShapeInfer() const override {
+        auto sampling = ov::as_type_ptr<TokenSamplingNode>(m_op);
+        if (!sampling) {
+            IE_THROW(Unexpected) << "Wrong operation type";
+        }
+        return std::make_shared<TokenSamplingShapeInfer>(sampling->get_k());
+    }
+private:
+    std::shared_ptr<ov::Node> m_op;
+};
+
+// Rows shorter than this are not split between threads: the merge would cost more than the split saves.
+constexpr size_t minVocabChunk = 2048;
+// Logits are processed in blocks that stay in L1 between the max, exp-sum and selection sweeps.
+constexpr size_t blockSize = 256;
+}   // namespace
+
+bool TokenSampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto sampling = ov::as_type_ptr<const TokenSamplingNode>(op);
+        if (!sampling) {
+            errorMessage = "Only TokenSampling from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+TokenSampling::TokenSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, TokenSamplingShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "TokenSampling node with name '" + getName() + "'";
+    const auto sampling = ov::as_type_ptr<const TokenSamplingNode>(op);
+    k = sampling->get_k();
+    invTemperature = 1.f / sampling->get_temperature();
+}
+
+void TokenSampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    idxPrecision = getOriginalOutputPrecisionAtPort(1);
+    if (idxPrecision != InferenceEngine::Precision::I32 && idxPrecision != InferenceEngine::Precision::I64) {
+        idxPrecision = InferenceEngine::Precision::I32;
+    }
+
+    addSupportedPrimDesc({{LayoutType::ncsp, InferenceEngine::Precision::FP32}},
+                         {{LayoutType::ncsp, InferenceEngine::Precision::FP32},
+                          {LayoutType::ncsp, idxPrecision}},
+                         ref_any);
+}
+
+void TokenSampling::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemoryPtr()->getStaticDims();
+    vocabSize = srcDims.back();
+    rowsNum = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    if (vocabSize < k) {
+        IE_THROW() << errorPrefix << " has k = " << k << " which exceeds the innermost input dimension " << vocabSize;
+    }
+
+    // all the buffers are allocated here, so that the decode step itself does not touch the heap
+    const size_t nthr = parallel_get_max_threads();
+    partials.resize(nthr);
+    for (auto& state : partials) {
+        state.heap.reserve(k);
+    }
+    merged.reserve(nthr * k);
+}
+
+void TokenSampling::PartialState::reset() {
+    max = -std::numeric_limits<float>::infinity();
+    sum = 0.f;
+    heap.clear();
+}
+
+void TokenSampling::accumulate(const float* src, size_t begin, size_t end, PartialState& state) const {
+    // The heap keeps the k best candidates with the worst one on top, so most logits are rejected by a single compare.
+    // Candidates are ordered as TopK(sort=value) does: larger value first, lower index first among equal values.
+    auto precedes = [](const Candidate& a, const Candidate& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    };
+
+    float scaled[blockSize];
+    for (size_t blockStart = begin; blockStart < end; blockStart += blockSize) {
+        const size_t blockLen = std::min(blockSize, end - blockStart);
+        const float* blockSrc = src + blockStart;
+
+        float blockMax = -std::numeric_limits<float>::infinity();
+        for (size_t i = 0; i < blockLen; i++) {
+            scaled[i] = blockSrc[i] * invTemperature;
+            blockMax = std::max(blockMax, scaled[i]);
+        }
+
+        // online softmax: rescale the running sum whenever the running maximum grows
+        if (blockMax > state.max) {
+            state.sum *= std::exp(state.max - blockMax);
+            state.max = blockMax;
+        }
+        if (state.max != -std::numeric_limits<float>::infinity()) {
+            float blockSum = 0.f;
+            for (size_t i = 0; i < blockLen; i++) {
+                blockSum += std::exp(scaled[i] - state.max);
+            }
+            state.sum += blockSum;
+        }
+
+        for (size_t i = 0; i < blockLen; i++) {
+            const Candidate candidate{scaled[i], static_cast<int64_t>(blockStart + i)};
+            if (state.heap.size() < k) {
+                state.heap.push_back(candidate);
+                std::push_heap(state.heap.begin(), state.heap.end(), precedes);
+            } else if (precedes(candidate, state.heap.front())) {
+                std::pop_heap(state.heap.begin(), state.heap.end(), precedes);
+                state.heap.back() = candidate;
+                std::push_heap(state.heap.begin(), state.heap.end(), precedes);
+            }
+        }
+    }
+}
+
+template <typename idx_t>
+void TokenSampling::finalize(PartialState* states, size_t statesNum, size_t row) {
+    auto precedes = [](const Candidate& a, const Candidate& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    };
+
+    float max = -std::numeric_limits<float>::infinity();
+    for (size_t i = 0; i < statesNum; i++) {
+        max = std::max(max, states[i].max);
+    }
+    float sum = 0.f;
+    for (size_t i = 0; i < statesNum; i++) {
+        if (states[i].sum > 0.f) {
+            sum += states[i].sum * std::exp(states[i].max - max);
+        }
+    }
+
+    Candidate* best = nullptr;
+    if (statesNum == 1) {
+        std::sort_heap(states[0].heap.begin(), states[0].heap.end(), precedes);
+        best = states[0].heap.data();
+    } else {
+        merged.clear();
+        for (size_t i = 0; i < statesNum; i++) {
+            merged.insert(merged.end(), states[i].heap.begin(), states[i].heap.end());
+        }
+        std::partial_sort(merged.begin(), merged.begin() + k, merged.end(), precedes);
+        best = merged.data();
+    }
+
+    auto* dstProbs = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->getData()) + row * k;
+    auto* dstIdx = reinterpret_cast<idx_t*>(getChildEdgesAtPort(1)[0]->getMemoryPtr()->getData()) + row * k;
+    const float invSum = sum > 0.f ? 1.f / sum : 0.f;
+    for (size_t i = 0; i < k; i++) {
+        dstProbs[i] = std::exp(best[i].first - max) * invSum;
+        dstIdx[i] = static_cast<idx_t>(best[i].second);
+    }
+}
+
+template <typename idx_t>
+void TokenSampling::executeImpl() {
+    const auto* srcData = reinterpret_cast<const float*>(getParentEdgeAt(0)->getMemoryPtr()->getData());
+    const size_t maxThreads = partials.size();
+
+    if (rowsNum >= maxThreads || vocabSize < 2 * minVocabChunk) {
+        // enough rows to keep every thread busy: each row is handled by one thread in a single pass
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(rowsNum, nthr, ithr, start, end);
+            auto& state = partials[ithr];
+            for (size_t row = start; row < end; row++) {
+                state.reset();
+                accumulate(srcData + row * vocabSize, 0, vocabSize, state);
+                finalize<idx_t>(&state, 1, row);
+            }
+        });
+        return;
+    }
+
+    // few long rows (the usual decode step): split the vocabulary between threads and merge per-thread partial heaps
+    const size_t chunksNum = std::min(maxThreads, vocabSize / minVocabChunk);
+    for (size_t row = 0; row < rowsNum; row++) {
+        const float* rowSrc = srcData + row * vocabSize;
+        for (auto& state : partials) {
+            state.reset();
+        }
+        parallel_nt(static_cast<int>(chunksNum), [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(vocabSize, nthr, ithr, start, end);
+            accumulate(rowSrc, start, end, partials[ithr]);
+        });
+        finalize<idx_t>(partials.data(), chunksNum, row);
+    }
+}
+
+void TokenSampling::execute(dnnl::stream strm) {
+    if (idxPrecision == InferenceEngine::Precision::I32) {
+        executeImpl<int32_t>();
+    } else if (idxPrecision == InferenceEngine::Precision::I64) {
+        executeImpl<int64_t>();
+    } else {
+        IE_THROW() << errorPrefix << " has unsupported index precision: " << idxPrecision;
+    }
+}
+
+void TokenSampling::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool TokenSampling::created() const {
+    return getType() == Type::TokenSampling;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
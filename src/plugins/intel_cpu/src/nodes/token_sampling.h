@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class TokenSampling : public Node {
+public:
+    TokenSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+private:
+    // scaled logit and its index in the vocabulary
+    using Candidate = std::pair<float, int64_t>;
+
+    // running softmax statistics and the k best candidates of a contiguous part of one row
+    struct PartialState {
+        float max;
+        float sum;
+        std::vector<Candidate> heap;
+
+        void reset();
+    };
+
+    template <typename idx_t>
+    void executeImpl();
+    void accumulate(const float* src, size_t begin, size_t end, PartialState& state) const;
+    template <typename idx_t>
+    void finalize(PartialState* states, size_t statesNum, size_t row);
+
+    size_t k = 0;
+    float invTemperature = 1.f;
+    size_t rowsNum = 0;
+    size_t vocabSize = 0;
+
+    std::vector<PartialState> partials;
+    std::vector<Candidate> merged;
+
+    InferenceEngine::Precision idxPrecision;
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -94,6 +94,8 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(jit_sse42_dw);
     CASE(jit_uni_dw);
     CASE(jit_avx512_amx);
+    CASE(jit_sparse_avx512);
+    CASE(jit_sparse_avx2);
     CASE(jit_avx512_amx_1x1);
     CASE(jit_avx512_amx_dw);
     CASE(brgconv_avx512);
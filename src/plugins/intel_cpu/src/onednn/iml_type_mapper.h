@@ -60,6 +60,8 @@ enum impl_desc_type {
     jit_sse42           = jit  | sse42,
     jit_uni             = jit  | uni,
     jit_avx512_amx      = jit  | avx512 | amx,
+    jit_sparse_avx512   = jit  | sparse | avx512,
+    jit_sparse_avx2     = jit  | sparse | avx2,
 
     jit_avx512_1x1      = jit  | avx512 | _1x1,
     jit_avx2_1x1        = jit  | avx2   | _1x1,
@@ -12,6 +12,7 @@
 #include "extension_mngr.h"
 #include "extension.h"
 #include "serialize.h"
+#include "openvino/runtime/mapped_stream_buffer.hpp"
 #include "threading/ie_executor_manager.hpp"
 
 #include "ie_icore.hpp"
@@ -25,6 +26,8 @@
 #include <ie_ngraph_utils.hpp>
 
 #include "performance_heuristics.hpp"
+#include "cpu_map_scheduling.hpp"
+#include "cpu_streams_autotune.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "weights_cache.hpp"
 #include "utils/denormals.hpp"
@@ -326,6 +329,12 @@ void Engine::CalculateStreams(Config& conf, const std::shared_ptr<ngraph::Functi
 
                 conf.modelPreferThreads = cache_model_prefer;
             }
+            // the pinning selected by the streams auto-tuning
+            const auto it_pinning = hints_config.find(ov::hint::enable_cpu_pinning.name());
+            if (it_pinning != hints_config.end() && !conf.changedCpuPinning) {
+                conf.enableCpuPinning = it_pinning->second.as<std::string>() == PluginConfigParams::YES;
+                conf.changedCpuPinning = true;
+            }
         }
         GetPerformanceStreams(conf, function);
         // save model_prefer_threads to model rt_info when loading network
@@ -500,6 +509,8 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     Config conf = engConfig;
 
     conf.readProperties(config);
+    // the streams auto-tuning recalculates the streams for each probed layout
+    const auto streamsConfig = conf.streamExecutorConfig;
     CalculateStreams(conf, nGraphFunc);
 
     Transformations transformations(nGraphFunc, enableLPT, inferencePrecision, isLegacyAPI(), snippetsMode, conf);
@@ -531,7 +542,87 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    const bool autoTuneStreams = conf.streamsAutoTune && is_cpu_map_available() &&
+                                 conf.perfHintsConfig.ovPerfHint == CONFIG_VALUE(THROUGHPUT) &&
+                                 !conf.streamExecutorConfig._streams_changed && !conf.exclusiveAsyncRequests &&
+                                 !nGraphFunc->is_dynamic();
+    auto execNetwork = autoTuneStreams
+                           ? AutoTuneStreams(clonedNetwork, conf, streamsConfig)
+                           : std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    SetupElasticStreams(*execNetwork, conf, streamsConfig, nGraphFunc);
+
+    return execNetwork;
+}
+
+void Engine::SetupElasticStreams(ExecNetwork& execNetwork,
+                                 const Config& conf,
+                                 const InferenceEngine::IStreamsExecutor::Config& streamsConfig,
+                                 const std::shared_ptr<ngraph::Function>& function) {
+    const auto& perfHint = conf.perfHintsConfig.ovPerfHint;
+    if (!conf.elasticStreams || !is_cpu_map_available() || conf.streamExecutorConfig._streams_changed ||
+        (perfHint != CONFIG_VALUE(LATENCY) && perfHint != CONFIG_VALUE(THROUGHPUT)))
+        return;
+
+    // the alternative layout is the one of the other performance hint
+    Config elasticConf = conf;
+    elasticConf.streamExecutorConfig = streamsConfig;
+    elasticConf.perfHintsConfig.ovPerfHint =
+        perfHint == CONFIG_VALUE(LATENCY) ? CONFIG_VALUE(THROUGHPUT) : CONFIG_VALUE(LATENCY);
+    elasticConf.perfHintsConfig.ovPerfHintNumRequests = 0;
+    GetPerformanceStreams(elasticConf, function);
+
+    execNetwork.EnableElasticStreams(elasticConf);
+}
+
+ExecNetwork::Ptr
+Engine::AutoTuneStreams(const InferenceEngine::CNNNetwork& network,
+                        const Config& conf,
+                        const InferenceEngine::IStreamsExecutor::Config& streamsConfig) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::AutoTuneStreams");
+    // long enough to amortize the streams start-up, short enough to keep the compilation time reasonable
+    const std::chrono::milliseconds trialDuration(300);
+    const auto function = network.getFunction();
+
+    auto makeConfig = [&](const StreamsTuneCandidate& candidate) {
+        Config candidateConf = conf;
+        candidateConf.streamExecutorConfig = streamsConfig;
+        candidateConf.modelPreferThreads = candidate.threads_per_stream;
+        candidateConf.enableCpuPinning = candidate.cpu_pinning;
+        candidateConf.changedCpuPinning = true;
+        GetPerformanceStreams(candidateConf, function);
+        return candidateConf;
+    };
+
+    // only one trial network is alive at a time, so the tuning does not multiply the memory footprint. The streams
+    // executor of a trial is released with it instead of being kept by the executor manager for reuse
+    auto trial = [&](const StreamsTuneCandidate& candidate) {
+        Config trialConf = makeConfig(candidate);
+        trialConf.streamsTuneTrial = true;
+        double fps = 0.0;
+        {
+            auto trialNetwork = std::make_shared<ExecNetwork>(network, trialConf, extensionManager, shared_from_this());
+            fps = trialNetwork->MeasureThroughput(trialDuration);
+        }
+        executorManager()->clear(ExecNetwork::streamsTuneExecutorName);
+        return fps;
+    };
+
+    auto schedulingCoreType = conf.schedulingCoreType;
+    const auto proc_type_table = apply_scheduling_core_type(schedulingCoreType, get_proc_type_table());
+    const auto best = tune_streams(conf.modelPreferThreads,
+                                   conf.enableCpuPinning,
+                                   !conf.changedCpuPinning,
+                                   proc_type_table,
+                                   trial);
+
+    // the selected layout is exported with the model, so the trials are skipped when it is imported from the cache
+    ov::AnyMap hints_props;
+    hints_props.insert({"MODEL_PREFER_THREADS", std::to_string(best.threads_per_stream)});
+    hints_props.insert({ov::hint::enable_cpu_pinning.name(),
+                        std::string(best.cpu_pinning ? PluginConfigParams::YES : PluginConfigParams::NO)});
+    function->set_rt_info(hints_props, "intel_cpu_hints_config");
+
+    return std::make_shared<ExecNetwork>(network, makeConfig(best), extensionManager, shared_from_this());
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -684,6 +775,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RO_property(ov::range_for_streams.name()),
                                                     RO_property(ov::device::full_name.name()),
                                                     RO_property(ov::device::capabilities.name()),
+                                                    RO_property(ov::intel_cpu::shared_weights_memory_size.name()),
         };
         // the whole config is RW before model is loaded.
         std::vector<ov::PropertyName> rwProperties {RW_property(ov::num_streams.name()),
@@ -700,6 +792,13 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::device::id.name()),
                                                     RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                     RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+                                                    RW_property(ov::intel_cpu::share_weights_across_models.name()),
+                                                    RW_property(ov::intel_cpu::streams_auto_tune.name()),
+                                                    RW_property(ov::intel_cpu::elastic_streams.name()),
+                                                    RW_property(ov::intel_cpu::dynamic_quantization.name()),
+                                                    RW_property(ov::intel_cpu::kernel_cache_dir.name()),
+                                                    RW_property(ov::intel_cpu::kernel_cache_size.name()),
+                                                    RW_property(ov::intel_cpu::layout_optimization.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -742,6 +841,23 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::share_weights_across_models) {
+        return decltype(ov::intel_cpu::share_weights_across_models)::value_type(engConfig.shareWeightsAcrossModels);
+    } else if (name == ov::intel_cpu::streams_auto_tune) {
+        return decltype(ov::intel_cpu::streams_auto_tune)::value_type(engConfig.streamsAutoTune);
+    } else if (name == ov::intel_cpu::elastic_streams) {
+        return decltype(ov::intel_cpu::elastic_streams)::value_type(engConfig.elasticStreams);
+    } else if (name == ov::intel_cpu::dynamic_quantization) {
+        return decltype(ov::intel_cpu::dynamic_quantization)::value_type(engConfig.fcDynamicQuantization);
+    } else if (name == ov::intel_cpu::kernel_cache_dir) {
+        return decltype(ov::intel_cpu::kernel_cache_dir)::value_type(engConfig.kernelCacheDir);
+    } else if (name == ov::intel_cpu::kernel_cache_size) {
+        return decltype(ov::intel_cpu::kernel_cache_size)::value_type(engConfig.kernelCacheSize);
+    } else if (name == ov::intel_cpu::layout_optimization) {
+        return decltype(ov::intel_cpu::layout_optimization)::value_type(engConfig.layoutOptimization);
+    } else if (name == ov::intel_cpu::shared_weights_memory_size) {
+        const auto size = GlobalWeightsStore::instance()->getMemorySize();
+        return decltype(ov::intel_cpu::shared_weights_memory_size)::value_type(size);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -809,12 +925,15 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     Config conf = engConfig;
     conf.readProperties(config);
+    conf.mappedWeights = dynamic_cast<ov::MappedStreamBuffer*>(networkModel.rdbuf()) != nullptr;
 
     auto function = cnnnetwork.getFunction();
 
+    const auto streamsConfig = conf.streamExecutorConfig;
     CalculateStreams(conf, function, true);
 
     auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    SetupElasticStreams(*execNetwork, conf, streamsConfig, function);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -51,6 +51,15 @@ private:
 
     void CalculateStreams(Config& conf, const std::shared_ptr<ngraph::Function>& ngraphFunc, bool imported = false);
 
+    ExecNetwork::Ptr AutoTuneStreams(const InferenceEngine::CNNNetwork& network,
+                                     const Config& conf,
+                                     const InferenceEngine::IStreamsExecutor::Config& streamsConfig);
+
+    void SetupElasticStreams(ExecNetwork& execNetwork,
+                             const Config& conf,
+                             const InferenceEngine::IStreamsExecutor::Config& streamsConfig,
+                             const std::shared_ptr<ngraph::Function>& function);
+
     StreamCfg GetNumStreams(InferenceEngine::IStreamsExecutor::ThreadBindingType thread_binding_type,
                             int stream_mode,
                             const bool enable_hyper_thread = true) const;
@@ -4,6 +4,7 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/mapped_stream_buffer.hpp>
 
 #include <pugixml.hpp>
 
@@ -59,6 +60,33 @@ namespace {
             info_iter->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    // Exposes the weights part of a mapped compiled model blob as a blob, the mapping lives as long as the blob
+    class MappedWeightsAllocator : public InferenceEngine::IAllocator {
+    public:
+        MappedWeightsAllocator(std::shared_ptr<ov::MappedMemory> mappedMemory, size_t offset)
+            : _mappedMemory(std::move(mappedMemory)), _offset(offset) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle;
+        }
+
+        void unlock(void*) noexcept override {}
+
+        void* alloc(size_t size) noexcept override {
+            if (_offset > _mappedMemory->size() || size > _mappedMemory->size() - _offset)
+                return nullptr;
+            return _mappedMemory->data() + _offset;
+        }
+
+        bool free(void*) noexcept override {
+            return true;
+        }
+
+    private:
+        std::shared_ptr<ov::MappedMemory> _mappedMemory;
+        size_t _offset;
+    };
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
@@ -146,10 +174,20 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        if (auto mappedBuffer = dynamic_cast<ov::MappedStreamBuffer*>(_istream.rdbuf())) {
+            // the weights stay in the mapped blob and are paged in on first use
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                desc, std::make_shared<MappedWeightsAllocator>(mappedBuffer->get_mapped_memory(),
+                                                               mappedBuffer->get_offset()));
+            dataBlob->allocate();
+            if (!dataBlob->buffer())
+                IE_THROW(NetworkNotRead) << "The weights are out of the compiled model blob.";
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(desc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::ImagePreprocessNode::ImagePreprocessNode(const ov::OutputVector& args, const Attributes& attrs)
+    : Op(args), m_attrs(attrs) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::ImagePreprocessNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ImagePreprocessNode>(new_args, m_attrs);
+}
+
+bool ov::intel_cpu::ImagePreprocessNode::visit_attributes(ov::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_visit_attributes);
+    visitor.on_attribute("color_format", m_attrs.color_format);
+    visitor.on_attribute("bgr", m_attrs.bgr);
+    visitor.on_attribute("round_color", m_attrs.round_color);
+    visitor.on_attribute("resize_mode", m_attrs.resize_mode);
+    visitor.on_attribute("target_size", m_attrs.target_size);
+    visitor.on_attribute("scale", m_attrs.scale);
+    visitor.on_attribute("shift", m_attrs.shift);
+    visitor.on_attribute("nchw_output", m_attrs.nchw_output);
+    return true;
+}
+
+size_t ov::intel_cpu::ImagePreprocessNode::get_planes_count() const {
+    return get_input_size() - (has_runtime_target_size() ? 1 : 0);
+}
+
+void ov::intel_cpu::ImagePreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_validate_and_infer_types);
+    const auto& color_format = m_attrs.color_format;
+    const auto& resize_mode = m_attrs.resize_mode;
+    NGRAPH_CHECK(color_format.empty() || color_format == "NV12" || color_format == "I420",
+                 "color_format attribute must be empty, NV12 or I420 whereas current value is ", color_format);
+    NGRAPH_CHECK(resize_mode.empty() || resize_mode == "linear" || resize_mode == "nearest",
+                 "resize_mode attribute must be empty, linear or nearest whereas current value is ", resize_mode);
+    NGRAPH_CHECK(m_attrs.target_size.empty() || (!resize_mode.empty() && m_attrs.target_size.size() == 2),
+                 "target_size attribute must contain height and width of the resize");
+    NGRAPH_CHECK(m_attrs.scale.size() == m_attrs.shift.size(), "scale and shift attributes must have the same size");
+
+    const auto planes = get_planes_count();
+    const auto expected_planes = color_format == "NV12" ? 2 : color_format == "I420" ? 3 : 1;
+    NGRAPH_CHECK(planes == 1 || planes == static_cast<size_t>(expected_planes),
+                 "Unexpected number of image planes: ", planes);
+
+    const auto& image_et = get_input_element_type(0);
+    NGRAPH_CHECK(image_et == ov::element::u8 || image_et == ov::element::f32,
+                 "image planes must be u8 or f32 whereas current element type is ", image_et);
+    for (size_t i = 1; i < planes; i++) {
+        NGRAPH_CHECK(get_input_element_type(i) == image_et, "all the image planes must have the same element type");
+    }
+    if (has_runtime_target_size()) {
+        const auto& size_et = get_input_element_type(planes);
+        NGRAPH_CHECK(size_et == ov::element::i32 || size_et == ov::element::i64,
+                     "target size input must be i32 or i64 whereas current element type is ", size_et);
+    }
+
+    const auto& image_shape = get_input_partial_shape(0);
+    NGRAPH_CHECK(image_shape.rank().compatible(4), "image planes must be 4D whereas current shape is ", image_shape);
+
+    ov::PartialShape out_shape(std::vector<ov::Dimension>(4));
+    if (image_shape.rank().is_static()) {
+        out_shape = image_shape;
+        if (!color_format.empty()) {
+            // a single plane holds Y rows followed by chroma rows
+            if (planes == 1 && out_shape[1].is_static()) {
+                out_shape[1] = out_shape[1].get_length() * 2 / 3;
+            } else if (planes == 1) {
+                out_shape[1] = ov::Dimension::dynamic();
+            }
+            out_shape[3] = 3;
+        }
+    }
+    if (!resize_mode.empty()) {
+        if (m_attrs.target_size.empty()) {
+            out_shape[1] = ov::Dimension::dynamic();
+            out_shape[2] = ov::Dimension::dynamic();
+        } else {
+            out_shape[1] = m_attrs.target_size[0];
+            out_shape[2] = m_attrs.target_size[1];
+        }
+    }
+    if (!m_attrs.scale.empty() && m_attrs.scale.size() != 1 && out_shape[3].is_static()) {
+        NGRAPH_CHECK(m_attrs.scale.size() == static_cast<size_t>(out_shape[3].get_length()),
+                     "scale and shift attributes must be defined per channel");
+    }
+    if (m_attrs.nchw_output) {
+        out_shape = {out_shape[0], out_shape[3], out_shape[1], out_shape[2]};
+    }
+
+    set_output_type(0, ov::element::f32, out_shape);
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/node.hpp>
+#include <openvino/op/op.hpp>
+
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+/**
+ * The operation fuses the image preprocessing chain created by ov::preprocess::PrePostProcessor at a model input:
+ * NV12/I420 to RGB/BGR conversion, resize, per-channel mean/scale and NHWC to NCHW layout conversion,
+ * so that the image is read once and the model input is written once.
+ * Inputs:
+ *     1. Image planes of type T1 in NHWC layout:
+ *        - packed image [N, H, W, C], no color conversion
+ *        - NV12: single plane [N, H * 3 / 2, W, 1] or Y [N, H, W, 1] and UV [N, H / 2, W / 2, 2] planes
+ *        - I420: single plane [N, H * 3 / 2, W, 1] or Y [N, H, W, 1], U [N, H / 2, W / 2, 1], V [N, H / 2, W / 2, 1]
+ *     2. Target spatial size of type T2 and of shape [2], {height, width}. Present only if the image is resized
+ *        and the target size is not known at compile time
+ * Outputs:
+ *     1. Preprocessed image of type FP32 and of shape [N, C', H', W'] or [N, H', W', C'], where C' - number of
+ *        channels after the color conversion, H', W' - target spatial size
+ * Attributes:
+ *     color_format - "" (no conversion), "NV12" or "I420"
+ *     bgr - the color conversion produces BGR instead of RGB
+ *     round_color - the converted color components are rounded as they are stored in an integral type
+ *     resize_mode - "" (no resize), "linear" or "nearest" (round_prefer_floor), half_pixel coordinates, no antialias
+ *     target_size - static {height, width} of the resize, empty if it is given by the second input
+ *     scale, shift - per-channel (or single) affine transformation applied after the resize: y = x * scale + shift
+ *     nchw_output - the output is transposed to NCHW layout
+ * Types:
+ *     T1 - U8 and FP32 are supported
+ *     T2 - I32 and I64 are supported
+ */
+class ImagePreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("ImagePreprocess", "cpu_plugin_opset");
+
+    struct Attributes {
+        std::string color_format;
+        bool bgr = false;
+        bool round_color = false;
+        std::string resize_mode;
+        std::vector<int64_t> target_size;
+        std::vector<float> scale;
+        std::vector<float> shift;
+        bool nchw_output = false;
+    };
+
+    ImagePreprocessNode() = default;
+    ImagePreprocessNode(const ov::OutputVector& args, const Attributes& attrs);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    const Attributes& get_attrs() const { return m_attrs; }
+    size_t get_planes_count() const;
+    bool has_runtime_target_size() const { return !m_attrs.resize_mode.empty() && m_attrs.target_size.empty(); }
+
+private:
+    Attributes m_attrs;
+};
+}   // namespace intel_cpu
+}   // namespace ov
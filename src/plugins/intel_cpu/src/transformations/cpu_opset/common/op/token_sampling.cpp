@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "token_sampling.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::TokenSamplingNode::TokenSamplingNode(const ov::Output<Node>& logits,
+                                                    const size_t k,
+                                                    const float temperature,
+                                                    const ov::element::Type index_element_type)
+    : Op({logits}), m_k(k), m_temperature(temperature), m_index_element_type(index_element_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::TokenSamplingNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(TokenSamplingNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::TokenSamplingNode>(new_args.at(0), m_k, m_temperature, m_index_element_type);
+}
+
+bool ov::intel_cpu::TokenSamplingNode::visit_attributes(ov::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(TokenSamplingNode_visit_attributes);
+    visitor.on_attribute("k", m_k);
+    visitor.on_attribute("temperature", m_temperature);
+    visitor.on_attribute("index_element_type", m_index_element_type);
+    return true;
+}
+
+void ov::intel_cpu::TokenSamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(TokenSamplingNode_validate_and_infer_types);
+    NGRAPH_CHECK(m_k > 0, "k attribute must be greater than zero");
+    NGRAPH_CHECK(m_temperature > 0.f, "temperature attribute must be greater than zero");
+    NGRAPH_CHECK(m_index_element_type == ov::element::i32 || m_index_element_type == ov::element::i64,
+                 "index_element_type must be i32 or i64 whereas current element type is ", m_index_element_type);
+
+    const auto& logits_et = get_input_element_type(0);
+    const auto& logits_shape = get_input_partial_shape(0);
+    NGRAPH_CHECK(logits_et.is_real(), "'logits' input must be real whereas current element type is ", logits_et);
+    NGRAPH_CHECK(logits_shape.rank().is_static() && logits_shape.rank().get_length() > 0,
+                 "'logits' input must have static non-zero rank whereas current shape is ", logits_shape);
+
+    auto out_shape = logits_shape;
+    auto& vocab_dim = out_shape[out_shape.size() - 1];
+    NGRAPH_CHECK(vocab_dim.is_dynamic() || static_cast<size_t>(vocab_dim.get_length()) >= m_k,
+                 "k attribute must not exceed the innermost dimension of 'logits' whereas current shape is ", logits_shape);
+    vocab_dim = static_cast<int64_t>(m_k);
+
+    set_output_type(0, logits_et, out_shape);
+    set_output_type(1, m_index_element_type, out_shape);
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/node.hpp>
+#include <openvino/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+/**
+ * The operation fuses temperature scaling, Softmax and TopK(mode=max, sort=value) over the innermost axis of the logits,
+ * which is the sampling step that ends every iteration of a generative decode loop.
+ * Inputs:
+ *     1. Logits of type T1 - shape [..., V], where V - vocabulary size. Required
+ * Outputs:
+ *     1. Probabilities of the k best tokens of type T1 and of shape [..., k], sorted in descending order.
+ *     2. Indices of the k best tokens of type T2 and of shape [..., k].
+ * Attributes:
+ *     k - number of selected tokens, k == 1 corresponds to greedy selection
+ *     temperature - logits are divided by the temperature before Softmax
+ * Types:
+ *     T1 - only FP32 is supported
+ *     T2 - I32 and I64 are supported
+ */
+class TokenSamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("TokenSampling", "cpu_plugin_opset");
+
+    TokenSamplingNode() = default;
+    TokenSamplingNode(const ov::Output<Node>& logits,
+                      const size_t k,
+                      const float temperature,
+                      const ov::element::Type index_element_type = ov::element::i32);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    size_t get_k() const { return m_k; }
+    float get_temperature() const { return m_temperature; }
+    ov::element::Type get_index_element_type() const { return m_index_element_type; }
+
+private:
+    size_t m_k = 1;
+    float m_temperature = 1.f;
+    ov::element::Type m_index_element_type = ov::element::i32;
+};
+}   // namespace intel_cpu
+}   // namespace ov
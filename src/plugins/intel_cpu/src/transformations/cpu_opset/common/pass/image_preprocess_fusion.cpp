@@ -0,0 +1,249 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess_fusion.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset4.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/opsets/opset11.hpp>
+#include <openvino/core/rt_info.hpp>
+
+#include <algorithm>
+
+#include "transformations/itt.hpp"
+
+namespace {
+using Attributes = ov::intel_cpu::ImagePreprocessNode::Attributes;
+using InterpolateBase = ov::op::util::InterpolateBase;
+
+std::shared_ptr<ov::Node> get_single_consumer(const ov::Output<ov::Node>& output) {
+    const auto consumers = output.get_target_inputs();
+    if (consumers.size() != 1)
+        return nullptr;
+    return consumers.begin()->get_node()->shared_from_this();
+}
+
+bool is_f32_convert(const std::shared_ptr<ov::Node>& node) {
+    return node && ov::is_type<ov::opset1::Convert>(node) && node->get_output_element_type(0) == ov::element::f32;
+}
+
+bool is_color_conversion(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type<ov::opset8::NV12toRGB>(node) || ov::is_type<ov::opset8::NV12toBGR>(node) ||
+           ov::is_type<ov::opset8::I420toRGB>(node) || ov::is_type<ov::opset8::I420toBGR>(node);
+}
+
+// values of a real constant which is broadcast along the channel axis of 4D tensor only
+bool get_channel_values(const std::shared_ptr<ov::Node>& node,
+                        const size_t channel_axis,
+                        const size_t channels,
+                        std::vector<float>& values) {
+    const auto constant = ov::as_type_ptr<ov::opset1::Constant>(node);
+    if (!constant || !constant->get_element_type().is_real())
+        return false;
+    const auto& shape = constant->get_shape();
+    if (shape.size() > 4)
+        return false;
+    for (size_t i = 0; i < shape.size(); i++) {
+        if (shape[i] != 1 && i + 4 - shape.size() != channel_axis)
+            return false;
+    }
+    const auto data = constant->cast_vector<float>();
+    if (data.size() == 1) {
+        values.assign(channels, data[0]);
+    } else if (data.size() == channels) {
+        values = data;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// folds the eltwise operation with the constant into y = x * scale + shift
+bool fold_affine(const std::shared_ptr<ov::Node>& node,
+                 const ov::Output<ov::Node>& data,
+                 const size_t channel_axis,
+                 std::vector<float>& scale,
+                 std::vector<float>& shift) {
+    const bool is_add = ov::is_type<ov::opset1::Add>(node);
+    const bool is_sub = ov::is_type<ov::opset1::Subtract>(node);
+    const bool is_mul = ov::is_type<ov::opset1::Multiply>(node);
+    const bool is_div = ov::is_type<ov::opset1::Divide>(node);
+    if (!is_add && !is_sub && !is_mul && !is_div)
+        return false;
+    if (node->get_autob().m_type != ov::op::AutoBroadcastType::NUMPY)
+        return false;
+    const size_t data_idx = node->input_value(0) == data ? 0 : 1;
+    // x - c and x / c only, the constant must not broadcast the data
+    if ((is_sub || is_div) && data_idx != 0)
+        return false;
+    if (node->get_output_partial_shape(0) != data.get_partial_shape())
+        return false;
+
+    std::vector<float> values;
+    if (!get_channel_values(node->get_input_node_shared_ptr(1 - data_idx), channel_axis, scale.size(), values))
+        return false;
+    for (size_t c = 0; c < scale.size(); c++) {
+        if (is_add) {
+            shift[c] += values[c];
+        } else if (is_sub) {
+            shift[c] -= values[c];
+        } else {
+            const float factor = is_mul ? values[c] : 1.f / values[c];
+            scale[c] *= factor;
+            shift[c] *= factor;
+        }
+    }
+    return true;
+}
+
+// resize of NHWC image over H and W axes, which is computed by the fused kernel
+bool get_resize_attributes(const std::shared_ptr<ov::Node>& node, Attributes& attrs, ov::Output<ov::Node>& target_size) {
+    const auto interpolate = ov::as_type_ptr<InterpolateBase>(node);
+    if (!interpolate || !(ov::is_type<ov::opset4::Interpolate>(node) || ov::is_type<ov::opset11::Interpolate>(node)))
+        return false;
+    const auto& interp_attrs = interpolate->get_attrs();
+    if (interp_attrs.shape_calculation_mode != InterpolateBase::ShapeCalcMode::SIZES || interp_attrs.antialias ||
+        interp_attrs.coordinate_transformation_mode != InterpolateBase::CoordinateTransformMode::HALF_PIXEL)
+        return false;
+    auto is_zero = [](size_t pad) { return pad == 0; };
+    if (!std::all_of(interp_attrs.pads_begin.begin(), interp_attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(interp_attrs.pads_end.begin(), interp_attrs.pads_end.end(), is_zero))
+        return false;
+
+    std::string mode;
+    if (interp_attrs.mode == InterpolateBase::InterpolateMode::LINEAR ||
+        interp_attrs.mode == InterpolateBase::InterpolateMode::LINEAR_ONNX) {
+        // without antialias both modes blend two nearest pixels with the coordinates clamped to the image
+        mode = "linear";
+    } else if (interp_attrs.mode == InterpolateBase::InterpolateMode::NEAREST &&
+               interp_attrs.nearest_mode == InterpolateBase::NearestMode::ROUND_PREFER_FLOOR) {
+        mode = "nearest";
+    } else {
+        return false;
+    }
+
+    const size_t axes_idx = ov::is_type<ov::opset4::Interpolate>(node) ? 3 : 2;
+    if (node->get_input_size() <= axes_idx)
+        return false;
+    const auto axes = ov::as_type_ptr<ov::opset1::Constant>(node->get_input_node_shared_ptr(axes_idx));
+    if (!axes)
+        return false;
+    auto axes_values = axes->cast_vector<int64_t>();
+    for (auto& axis : axes_values) {
+        axis = axis < 0 ? axis + 4 : axis;
+    }
+    if (axes_values != std::vector<int64_t>{1, 2})
+        return false;
+
+    const auto sizes = node->input_value(1);
+    if (const auto sizes_const = ov::as_type_ptr<ov::opset1::Constant>(sizes.get_node_shared_ptr())) {
+        const auto sizes_values = sizes_const->cast_vector<int64_t>();
+        if (sizes_values.size() != 2 || sizes_values[0] <= 0 || sizes_values[1] <= 0)
+            return false;
+        attrs.target_size = sizes_values;
+    } else {
+        if (!(sizes.get_element_type() == ov::element::i32 || sizes.get_element_type() == ov::element::i64) ||
+            !sizes.get_partial_shape().compatible(ov::PartialShape{2}))
+            return false;
+        target_size = sizes;
+    }
+    attrs.resize_mode = mode;
+    return true;
+}
+
+// model input with its single optional conversion to f32
+bool get_image_plane(ov::Output<ov::Node>& plane, ov::NodeVector& fused_nodes) {
+    const auto convert = plane.get_node_shared_ptr();
+    if (is_f32_convert(convert) && plane.get_target_inputs().size() == 1) {
+        plane = convert->input_value(0);
+        fused_nodes.push_back(convert);
+    }
+    return ov::is_type<ov::opset1::Parameter>(plane.get_node()) && plane.get_target_inputs().size() == 1 &&
+           (plane.get_element_type() == ov::element::u8 || plane.get_element_type() == ov::element::f32);
+}
+}   // namespace
+
+bool ov::intel_cpu::ImagePreprocessFusion::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(ImagePreprocessFusion);
+    bool rewritten = false;
+    for (const auto& node : model->get_ordered_ops()) {
+        // the chain starts at the color conversion of the model inputs, which is inserted by PrePostProcessor only.
+        // A resize of the RGB model input alone is left to the JIT Interpolate node
+        if (!is_color_conversion(node))
+            continue;
+        Attributes attrs;
+        ov::OutputVector planes;
+        ov::NodeVector fused_nodes;
+        const bool is_nv12 = ov::is_type<ov::opset8::NV12toRGB>(node) || ov::is_type<ov::opset8::NV12toBGR>(node);
+        attrs.color_format = is_nv12 ? "NV12" : "I420";
+        attrs.bgr = ov::is_type<ov::opset8::NV12toBGR>(node) || ov::is_type<ov::opset8::I420toBGR>(node);
+        bool supported = true;
+        for (const auto& input : node->input_values()) {
+            auto plane = input;
+            supported = supported && get_image_plane(plane, fused_nodes);
+            planes.push_back(plane);
+        }
+        if (!supported)
+            continue;
+        fused_nodes.push_back(node);
+        ov::Output<ov::Node> cur = node->output(0);
+        // the color components are stored as integers by the reference conversion of u8 planes
+        attrs.round_color = cur.get_element_type() == ov::element::u8;
+        if (attrs.round_color) {
+            const auto convert = get_single_consumer(cur);
+            if (!is_f32_convert(convert))
+                continue;
+            fused_nodes.push_back(convert);
+            cur = convert->output(0);
+        }
+        if (cur.get_element_type() != ov::element::f32)
+            continue;
+        const auto& image_shape = cur.get_partial_shape();
+        if (image_shape.rank().is_dynamic() || image_shape.size() != 4 || image_shape[3].is_dynamic())
+            continue;
+
+        const size_t channels = static_cast<size_t>(image_shape[3].get_length());
+        std::vector<float> scale(channels, 1.f), shift(channels, 0.f);
+        bool has_affine = false;
+        ov::Output<ov::Node> target_size;
+        while (const auto next = get_single_consumer(cur)) {
+            if (next->get_output_size() != 1)
+                break;
+            bool fused = fold_affine(next, cur, attrs.nchw_output ? 1 : 3, scale, shift);
+            has_affine = has_affine || fused;
+            // the resize is computed before the layout conversion, the per-channel operations commute with it
+            if (!fused && attrs.resize_mode.empty() && !attrs.nchw_output && next->input_value(0) == cur) {
+                fused = get_resize_attributes(next, attrs, target_size);
+            }
+            if (!fused && !attrs.nchw_output && ov::is_type<ov::opset1::Transpose>(next)) {
+                const auto order = ov::as_type_ptr<ov::opset1::Constant>(next->get_input_node_shared_ptr(1));
+                fused = order && order->cast_vector<int64_t>() == std::vector<int64_t>{0, 3, 1, 2};
+                attrs.nchw_output = fused;
+            }
+            if (!fused)
+                break;
+            fused_nodes.push_back(next);
+            cur = next->output(0);
+        }
+        if (has_affine) {
+            attrs.scale = scale;
+            attrs.shift = shift;
+        }
+
+        ov::OutputVector args = planes;
+        if (target_size.get_node()) {
+            args.push_back(target_size);
+        }
+        const auto preprocess = std::make_shared<ov::intel_cpu::ImagePreprocessNode>(args, attrs);
+        if (!preprocess->get_output_partial_shape(0).compatible(cur.get_partial_shape()))
+            continue;
+        const auto last = cur.get_node_shared_ptr();
+        preprocess->set_friendly_name(last->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, preprocess);
+        ov::replace_node(last, preprocess);
+        rewritten = true;
+    }
+    return rewritten;
+}
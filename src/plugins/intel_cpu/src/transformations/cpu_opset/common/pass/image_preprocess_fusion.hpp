@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Fuses the image preprocessing chain at the model inputs, as ov::preprocess::PrePostProcessor builds it:
+ * [Convert] -> [NV12/I420 to RGB/BGR] -> [Convert] -> [Add|Subtract|Multiply|Divide by per-channel constant]* ->
+ * [Interpolate] -> [Add|Subtract|Multiply|Divide by per-channel constant]* -> [Transpose NHWC to NCHW] -> ...
+ * into ImagePreprocessNode, so that the image is read once instead of being written and re-read by each step.
+ * The chain must start with a color conversion, a resize of the model input alone is left to the Interpolate node.
+ * The pass should run before the common optimizations, which move and split the layout conversion and the per-channel
+ * operations.
+ */
+class ImagePreprocessFusion: public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("ImagePreprocessFusion", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
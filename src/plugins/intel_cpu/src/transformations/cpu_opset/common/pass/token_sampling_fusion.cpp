@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "token_sampling_fusion.hpp"
+#include "transformations/cpu_opset/common/op/token_sampling.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/opsets/opset11.hpp>
+#include <openvino/core/rt_info.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include <cmath>
+
+#include "transformations/itt.hpp"
+
+using namespace ov::pass::pattern;
+ov::intel_cpu::TokenSamplingFusion::TokenSamplingFusion() {
+    MATCHER_SCOPE(TokenSamplingFusion);
+    auto logits_m = any_input(type_matches(ov::element::f32));
+    auto softmax_m = wrap_type<ov::opset1::Softmax, ov::opset8::Softmax>({logits_m}, consumers_count(1));
+    auto k_m = wrap_type<ov::opset1::Constant>();
+    auto topk_m = wrap_type<ov::opset1::TopK, ov::opset3::TopK, ov::opset11::TopK>({softmax_m, k_m});
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto topk = ov::as_type_ptr<ov::op::util::TopKBase>(m.get_match_root());
+        const auto softmax = pattern_map.at(softmax_m).get_node_shared_ptr();
+        if (!topk || transformation_callback(topk))
+            return false;
+
+        const auto& logits_shape = softmax->get_input_partial_shape(0);
+        if (logits_shape.rank().is_dynamic())
+            return false;
+        const auto rank = logits_shape.rank().get_length();
+
+        int64_t softmax_axis = 0;
+        if (const auto softmax_v1 = ov::as_type_ptr<ov::opset1::Softmax>(softmax)) {
+            softmax_axis = static_cast<int64_t>(softmax_v1->get_axis());
+        } else {
+            softmax_axis = ov::as_type_ptr<ov::opset8::Softmax>(softmax)->get_axis();
+            softmax_axis = softmax_axis < 0 ? softmax_axis + rank : softmax_axis;
+        }
+        // the fused node reduces over the innermost (contiguous) axis only
+        if (softmax_axis != rank - 1 || static_cast<int64_t>(topk->get_axis()) != rank - 1)
+            return false;
+        if (topk->get_mode() != ov::op::TopKMode::MAX || topk->get_sort_type() != ov::op::TopKSortType::SORT_VALUES)
+            return false;
+
+        const auto k_const = ov::as_type_ptr<ov::opset1::Constant>(pattern_map.at(k_m).get_node_shared_ptr());
+        if (ov::shape_size(k_const->get_shape()) != 1)
+            return false;
+        const auto k = k_const->cast_vector<int64_t>()[0];
+        if (k <= 0)
+            return false;
+
+        ov::NodeVector fused_nodes{softmax, topk};
+        auto logits = softmax->input_value(0);
+        float temperature = 1.f;
+        // optional temperature scaling: logits / T or logits * (1 / T)
+        const auto scale = logits.get_node_shared_ptr();
+        if ((ov::is_type<ov::opset1::Divide>(scale) || ov::is_type<ov::opset1::Multiply>(scale)) &&
+            scale->get_output_target_inputs(0).size() == 1) {
+            const auto scale_const = ov::as_type_ptr<ov::opset1::Constant>(scale->get_input_node_shared_ptr(1));
+            if (scale_const && ov::shape_size(scale_const->get_shape()) == 1 &&
+                scale->get_input_partial_shape(0) == logits_shape) {
+                const auto value = scale_const->cast_vector<float>()[0];
+                const auto candidate = ov::is_type<ov::opset1::Divide>(scale) ? value : 1.f / value;
+                if (candidate > 0.f && std::isfinite(candidate)) {
+                    temperature = candidate;
+                    logits = scale->input_value(0);
+                    fused_nodes.push_back(scale);
+                }
+            }
+        }
+
+        const auto sampling = std::make_shared<ov::intel_cpu::TokenSamplingNode>(logits,
+                                                                                 static_cast<size_t>(k),
+                                                                                 temperature,
+                                                                                 topk->get_index_element_type());
+        sampling->set_friendly_name(topk->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, sampling);
+        ov::replace_node(topk, sampling);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(topk_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Fuses [Multiply|Divide by scalar] -> Softmax -> TopK(mode=max, sort=value) over the innermost axis
+ * into TokenSamplingNode, so that vocabulary sized logits are read once instead of being written and re-read
+ * by each operation of the decode step.
+ */
+class TokenSamplingFusion: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("TokenSamplingFusion", "0");
+    TokenSamplingFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -20,6 +20,7 @@
 #include "common/pass/rnn_sequences_optimization.hpp"
 #include "transformations/common_optimizations/reshape_sequence_fusion.hpp"
 #include "common/pass/ngram_fusion.hpp"
+#include "common/pass/token_sampling_fusion.hpp"
 #include "transformations/defs.hpp"
 
 #include "itt.hpp"
@@ -49,6 +50,7 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertPrecision, precisions_map {{ ngraph::element::i64, ngraph::element::i32 }});
     CPU_REGISTER_PASS_COMMON(manager, NgramFusion);
+    CPU_REGISTER_PASS_COMMON(manager, TokenSamplingFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
 
     manager.run_passes(nGraphFunc);
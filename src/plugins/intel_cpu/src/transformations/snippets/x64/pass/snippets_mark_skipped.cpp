@@ -285,7 +285,7 @@ bool isSuitableChildForFusingMatMul(const std::shared_ptr<const Node> &node, con
         return true;
     }
 
-    // FuseMatMulAndSimpleOperation or FuseFullyConnectedAndSimpleOperation
+    // MatMul or FullyConnected and simple operations, see GraphOptimizer::FuseNodeAndSimpleOperations
     // Invoke SupportsFusingWithConvolution_Simple directly instead of isSuitableChildForFusingSimple to
     // eliminate getNumNonConstInputs() check
     fusingAxis = can_be_converted_to_FC ? (matmul_shape.size() == 3 ? 2 : 1) : matmul_shape.size() - 1;
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference_memoized.hpp"
+
+#include <algorithm>
+
+using namespace ov::intel_cpu;
+
+namespace {
+bool sameDims(const std::vector<VectorDims>& cached, const MemoizedShapeInfer::InputShapes& input_shapes) {
+    if (cached.size() != input_shapes.size())
+        return false;
+    for (size_t i = 0; i < cached.size(); i++) {
+        if (cached[i] != input_shapes[i].get())
+            return false;
+    }
+    return true;
+}
+}   // namespace
+
+MemoizedShapeInfer::MemoizedShapeInfer(ShapeInferPtr shapeInfer, size_t capacity)
+    : m_shapeInfer(std::move(shapeInfer)), m_capacity(capacity) {
+    IE_ASSERT(m_shapeInfer && m_capacity > 0);
+    IE_ASSERT(m_shapeInfer->get_port_mask() == EMPTY_PORT_MASK) << "Shape inference with data dependency cannot be memoized";
+    m_entries.reserve(m_capacity);
+}
+
+const MemoizedShapeInfer::Entry& MemoizedShapeInfer::inferCached(const InputShapes& input_shapes) {
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (sameDims(it->inputDims, input_shapes)) {
+            m_hits++;
+            std::rotate(m_entries.begin(), it, it + 1);
+            return m_entries.front();
+        }
+    }
+
+    m_misses++;
+    static const std::unordered_map<size_t, MemoryPtr> emptyDataDependency;
+    auto result = m_shapeInfer->infer(input_shapes, emptyDataDependency);
+
+    // evict the least recently used entry, its buffers are reused for the new one: the dims are copied
+    // element-wise, so the vectors of the evicted entry keep their capacity
+    if (m_entries.size() < m_capacity) {
+        m_entries.emplace_back();
+    }
+    auto& entry = m_entries.back();
+    entry.inputDims.resize(input_shapes.size());
+    for (size_t i = 0; i < input_shapes.size(); i++) {
+        entry.inputDims[i] = input_shapes[i].get();
+    }
+    entry.result.dims.resize(result.dims.size());
+    for (size_t i = 0; i < result.dims.size(); i++) {
+        entry.result.dims[i] = result.dims[i];
+    }
+    entry.result.status = result.status;
+    entry.padsBegin = m_shapeInfer->get_pads_begin();
+    entry.padsEnd = m_shapeInfer->get_pads_end();
+    std::rotate(m_entries.begin(), m_entries.end() - 1, m_entries.end());
+    return m_entries.front();
+}
+
+IShapeInfer::Result MemoizedShapeInfer::infer(
+        const InputShapes& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    return inferCached(input_shapes).result;
+}
+
+const ov::CoordinateDiff& MemoizedShapeInfer::get_pads_begin() {
+    return m_entries.empty() ? m_shapeInfer->get_pads_begin() : m_entries.front().padsBegin;
+}
+
+const ov::CoordinateDiff& MemoizedShapeInfer::get_pads_end() {
+    return m_entries.empty() ? m_shapeInfer->get_pads_end() : m_entries.front().padsEnd;
+}
+
+IShapeInfer::port_mask_t MemoizedShapeInfer::get_port_mask() const {
+    return m_shapeInfer->get_port_mask();
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shape_inference_cpu.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Shape inference decorator that memoizes input dims -> output dims for implementations without data dependency.
+ * Dynamic models with a small set of recurring shapes (e.g. NLP with short sequences) then resolve most shape
+ * inference calls with a lookup that reuses the stored dims and does not touch the heap.
+ * The pads produced by the wrapped implementation are stored along with the output dims, so get_pads_begin()
+ * and get_pads_end() always correspond to the last inferred input shapes.
+ */
+class MemoizedShapeInfer final : public IShapeInfer {
+public:
+    using InputShapes = std::vector<std::reference_wrapper<const VectorDims>>;
+
+    struct Entry {
+        std::vector<VectorDims> inputDims;
+        Result result;
+        ov::CoordinateDiff padsBegin;
+        ov::CoordinateDiff padsEnd;
+    };
+
+    MemoizedShapeInfer(ShapeInferPtr shapeInfer, size_t capacity);
+
+    /**
+     * @brief Returns the memoized result for the input shapes, running the wrapped shape inference on a miss.
+     * The reference is valid until the next call.
+     */
+    const Entry& inferCached(const InputShapes& input_shapes);
+
+    Result infer(
+        const InputShapes& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+    const ov::CoordinateDiff& get_pads_begin() override;
+    const ov::CoordinateDiff& get_pads_end() override;
+    port_mask_t get_port_mask() const override;
+
+    const ShapeInferPtr& getWrapped() const { return m_shapeInfer; }
+    size_t hits() const { return m_hits; }
+    size_t misses() const { return m_misses; }
+
+    static constexpr size_t defaultCapacity = 16;
+
+private:
+    ShapeInferPtr m_shapeInfer;
+    size_t m_capacity;
+    // most recently used entry goes first
+    std::vector<Entry> m_entries;
+    size_t m_hits = 0;
+    size_t m_misses = 0;
+};
+
+} // namespace intel_cpu
+} // namespace ov
@@ -5,7 +5,11 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -71,6 +75,96 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+const GlobalWeightsStore::Ptr& GlobalWeightsStore::instance() {
+    // the released memory refers to the store, so the store outlives all the compiled models
+    static const Ptr store = std::make_shared<GlobalWeightsStore>();
+    return store;
+}
+
+uint64_t WeightsSharing::contentHash(const void* data, size_t size) {
+    HashInfo::Ptr info;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = contentHashes[std::to_string(reinterpret_cast<uintptr_t>(data)) + "_" + std::to_string(size)];
+        if (!found)
+            found = std::make_shared<HashInfo>();
+        info = found;
+    }
+    // the streams requesting the same data wait for the first one instead of hashing it again
+    std::call_once(info->once, [&] {
+        info->value = GlobalWeightsStore::contentHash(data, size);
+    });
+    return info->value;
+}
+
+MemoryPtr GlobalWeightsStore::findOrCreate(const std::string& contentKey,
+                                           int socketId,
+                                           const std::function<MemoryPtr(void)>& create) {
+    const std::string key = std::to_string(socketId) + "_" + contentKey;
+    Entry::Ptr entry;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = entries[key];
+        if (!found)
+            found = std::make_shared<Entry>();
+        entry = found;
+    }
+
+    // only the requests for the same weights wait for each other
+    std::lock_guard<std::mutex> lock(entry->guard);
+    if (auto memory = entry->memory.lock()) {
+        hitsCount.fetch_add(1, std::memory_order_relaxed);
+        return memory;
+    }
+
+    MemoryPtr created = create();
+    const size_t size = created->getSize();
+    auto store = instance();
+    MemoryPtr memory(created.get(), [store, key, created, size](IMemory*) mutable {
+        created.reset();
+        store->release(key, size);
+    });
+    entry->memory = memory;
+    memorySize.fetch_add(size, std::memory_order_relaxed);
+    entriesCount.fetch_add(1, std::memory_order_relaxed);
+    return memory;
+}
+
+void GlobalWeightsStore::release(const std::string& key, size_t size) {
+    memorySize.fetch_sub(size, std::memory_order_relaxed);
+    entriesCount.fetch_sub(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = entries.find(key);
+    if (found == entries.end())
+        return;
+    // the entry might have been recreated in the meantime
+    std::lock_guard<std::mutex> entryLock(found->second->guard);
+    if (found->second->memory.expired())
+        entries.erase(found);
+}
+
+uint64_t GlobalWeightsStore::contentHash(const void* data, size_t size) {
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    const size_t chunkSize = 1 << 20;
+    const size_t chunks = (size + chunkSize - 1) / chunkSize;
+    if (chunks <= 1)
+        return hashFunc.hash(bytes, size);
+
+    // the weights are hashed chunk by chunk in parallel, the chunk hashes are hashed in order
+    std::vector<uint64_t> chunkHashes(chunks);
+    parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * chunkSize;
+        chunkHashes[i] = hashFunc.hash(bytes + offset, std::min(chunkSize, size - offset));
+    });
+    return hashFunc.hash(reinterpret_cast<const unsigned char*>(chunkHashes.data()), chunks * sizeof(uint64_t));
+}
+
+uint64_t GlobalWeightsStore::contentHash(const void* data, size_t size, const WeightsSharing::Ptr& weightsCache) {
+    return weightsCache ? weightsCache->contentHash(data, size) : contentHash(data, size);
+}
+
 SocketsWeights::SocketsWeights() {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++)
@@ -94,14 +94,84 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief GlobalWeightsStore::contentHash of the data, computed once for all the graphs sharing this cache
+     * The data is identified by its address, so it has to stay alive and unchanged as long as the cache does
+     */
+    uint64_t contentHash(const void* data, size_t size);
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    struct HashInfo {
+        typedef std::shared_ptr<HashInfo> Ptr;
+
+        std::once_flag once;
+        uint64_t value = 0;
+    };
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    std::unordered_map<std::string, HashInfo::Ptr> contentHashes;
     static const SimpleDataHash simpleCRC;
 };
 
+/**
+ * Process-wide content addressed store of packed weights
+ *
+ * Unlike WeightsSharing, which lives in the context of a single compiled model, this store is shared by all
+ * the compiled models of the process. Entries are keyed by the source weights content and the packed layout, so
+ * the compiled model variants of the same weights (different batch sizes, streams splits, shared backbones)
+ * keep a single packed copy. An entry is released as soon as the last compiled model referencing it is gone.
+ *
+ * Is a thread safe
+ */
+class GlobalWeightsStore {
+    struct Entry {
+        typedef std::shared_ptr<Entry> Ptr;
+
+        std::mutex guard;
+        std::weak_ptr<IMemory> memory;
+    };
+
+public:
+    typedef std::shared_ptr<GlobalWeightsStore> Ptr;
+
+    static const Ptr& instance();
+
+    /**
+     * @brief Returns the packed weights registered with the key or creates and registers them
+     * @param key has to be derived from the source weights content (see contentHash) and the packed layout
+     * @param socketId the entries are kept per socket, so the weights stay local to the NUMA node of the stream
+     */
+    MemoryPtr findOrCreate(const std::string& key, int socketId, const std::function<MemoryPtr(void)>& create);
+
+    /**
+     * @brief Hash of the weights content to be used as a part of the key
+     */
+    static uint64_t contentHash(const void* data, size_t size);
+
+    /**
+     * @brief Same as above, memoized in the weights cache of the compiled model (if any), so the graphs of all the
+     * streams hash the same weights once
+     */
+    static uint64_t contentHash(const void* data, size_t size, const WeightsSharing::Ptr& weightsCache);
+
+    // memory accounting
+    size_t getMemorySize() const { return memorySize.load(std::memory_order_relaxed); }
+    size_t getEntriesCount() const { return entriesCount.load(std::memory_order_relaxed); }
+    size_t getHitsCount() const { return hitsCount.load(std::memory_order_relaxed); }
+
+private:
+    void release(const std::string& key, size_t size);
+
+    mutable std::mutex guard;
+    std::unordered_map<std::string, Entry::Ptr> entries;
+    std::atomic<size_t> memorySize {0};
+    std::atomic<size_t> entriesCount {0};
+    std::atomic<size_t> hitsCount {0};
+};
+
 /**
  * Collection of memory caching store per socket
  *
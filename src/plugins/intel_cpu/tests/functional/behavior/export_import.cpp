@@ -6,7 +6,9 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "common_test_utils/test_common.hpp"
+#include "common_test_utils/file_utils.hpp"
 #include "ngraph_functions/builders.hpp"
 
 
@@ -135,4 +137,64 @@ INSTANTIATE_TEST_CASE_P(smoke_ExportImportTest,
                                                              testing_property_for_enable_hyper_threading,
                                                              testing_property_for_enable_cpu_pinning)));
 
+// The weights of a model imported from the cache directory are shared with the mapped blob, they still have to be
+// flushed the same way as on a fresh compilation
+std::shared_ptr<ov::Model> MakeSubnormalWeightsModel() {
+    const ov::Shape shape = {1, 64};
+    const ov::element::Type precision = ov::element::f32;
+
+    std::vector<float> weights(ov::shape_size(shape));
+    for (size_t i = 0; i < weights.size(); i++) {
+        // every second value is subnormal, so with the large inputs the flushed and the original weights give
+        // clearly different products
+        weights[i] = i % 2 ? 1e-40f : 0.5f;
+    }
+
+    auto params = ngraph::builder::makeParams(precision, {shape});
+    auto mul_const = ngraph::builder::makeConstant(precision, shape, weights);
+    auto mul = ngraph::builder::makeEltwise(params[0], mul_const, ngraph::helpers::EltwiseTypes::MULTIPLY);
+
+    ngraph::NodeVector results{mul};
+    return std::make_shared<ov::Model>(results, params, "SubnormalWeightsModel");
+}
+
+TEST(ExportImportMappedWeights, smoke_CachedModelMatchesFreshCompilation) {
+    const std::string cacheDir = "smoke_CachedModelMatchesFreshCompilation";
+    ov::test::utils::removeFilesWithExt(cacheDir, "blob");
+    ov::test::utils::removeDir(cacheDir);
+
+    auto model = MakeSubnormalWeightsModel();
+    ov::Tensor input(ov::element::f32, {1, 64});
+    std::fill_n(input.data<float>(), input.get_size(), 1e30f);
+
+    auto infer = [&](ov::CompiledModel& compiledModel) {
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        const auto& output = request.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    };
+
+    for (const bool denormalsOptimization : {false, true}) {
+        const ov::AnyMap config = {ov::intel_cpu::denormals_optimization(denormalsOptimization)};
+
+        ov::Core freshCore;
+        auto freshModel = freshCore.compile_model(model, "CPU", config);
+        const auto expected = infer(freshModel);
+
+        // the first compilation fills the cache, the second one imports the mapped blob
+        for (size_t i = 0; i < 2; i++) {
+            ov::Core core;
+            core.set_property(ov::cache_dir(cacheDir));
+            auto compiledModel = core.compile_model(model, "CPU", config);
+            ASSERT_EQ(compiledModel.get_property(ov::loaded_from_cache), i == 1);
+            ASSERT_EQ(infer(compiledModel), expected);
+        }
+
+        ov::test::utils::removeFilesWithExt(cacheDir, "blob");
+    }
+
+    ov::test::utils::removeDir(cacheDir);
+}
+
 }  // namespace
@@ -13,6 +13,16 @@
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "openvino/opsets/opset9.hpp"
+
+#include <fstream>
+#include <iterator>
+
+#if defined(__linux__)
+#include <sys/stat.h>
+#endif
 
 namespace {
 
@@ -40,6 +50,14 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::compile_stage_timings.name()),
+        RO_property(ov::intel_cpu::fusion_statistics.name()),
+        RO_property(ov::intel_cpu::reorder_statistics.name()),
+        RO_property(ov::intel_cpu::elastic_streams.name()),
+        RO_property(ov::intel_cpu::dynamic_quantization.name()),
+        RO_property(ov::intel_cpu::kernel_cache_dir.name()),
+        RO_property(ov::intel_cpu::kernel_cache_size.name()),
+        RO_property(ov::intel_cpu::layout_optimization.name()),
     };
 
     ov::Core ie;
@@ -144,6 +162,361 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckWeightsSharedAcrossModels) {
+    ov::Core core;
+    core.set_property(deviceName, ov::intel_cpu::share_weights_across_models(true));
+
+    const auto initialSize = core.get_property(deviceName, ov::intel_cpu::shared_weights_memory_size);
+    uint64_t sharedSize = 0;
+    {
+        ov::CompiledModel compiledModel = core.compile_model(model, deviceName, ov::num_streams(2));
+        sharedSize = core.get_property(deviceName, ov::intel_cpu::shared_weights_memory_size);
+        ASSERT_GT(sharedSize, initialSize);
+
+        // the variant compiled with the same weights does not add to the footprint
+        ov::CompiledModel variantModel = core.compile_model(model, deviceName, ov::num_streams(1));
+        ASSERT_EQ(sharedSize, core.get_property(deviceName, ov::intel_cpu::shared_weights_memory_size));
+    }
+    // the weights are released with the last compiled model referencing them
+    ASSERT_EQ(initialSize, core.get_property(deviceName, ov::intel_cpu::shared_weights_memory_size));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCompileStageTimings) {
+    ov::Core ie;
+    std::map<std::string, double> timings;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+
+    ASSERT_NO_THROW(timings = compiledModel.get_property(ov::intel_cpu::compile_stage_timings));
+    ASSERT_NE(timings.find("InitDescriptors"), timings.end());
+    ASSERT_NE(timings.find("CreatePrimitives"), timings.end());
+    for (const auto& timing : timings) {
+        ASSERT_GE(timing.second, 0.0) << timing.first;
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckFusionStatistics) {
+    ov::Core ie;
+    std::map<std::string, uint64_t> statistics;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+
+    ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::fusion_statistics));
+    for (const auto& entry : statistics) {
+        ASSERT_TRUE(entry.first.rfind("fused:", 0) == 0 || entry.first.rfind("unfused:", 0) == 0) << entry.first;
+        ASSERT_GT(entry.second, 0) << entry.first;
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckReorderStatistics) {
+    ov::Core ie;
+    std::map<std::string, uint64_t> statistics;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, ov::intel_cpu::layout_optimization(true));
+
+    ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::reorder_statistics));
+    for (const auto& key : {"before:reorders", "before:bytes", "after:reorders", "after:bytes"}) {
+        ASSERT_EQ(statistics.count(key), 1) << key;
+    }
+    // the refinement never increases the reorders cost
+    ASSERT_LE(statistics.at("after:bytes"), statistics.at("before:bytes"));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckStreamsAutoTune) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel;
+
+    ASSERT_NO_THROW(compiledModel = ie.compile_model(model,
+                                                     deviceName,
+                                                     ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                                                     ov::intel_cpu::streams_auto_tune(true)));
+    ASSERT_GT(compiledModel.get_property(ov::num_streams), 0);
+
+    auto request = compiledModel.create_infer_request();
+    ASSERT_NO_THROW(request.infer());
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckElasticStreams) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel;
+
+    ASSERT_NO_THROW(compiledModel = ie.compile_model(model,
+                                                     deviceName,
+                                                     ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+                                                     ov::intel_cpu::elastic_streams(true)));
+    ASSERT_NO_THROW(compiledModel.get_property(ov::intel_cpu::elastic_streams));
+
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, model->input().get_shape());
+    auto infer = [&](ov::InferRequest& request) {
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor();
+    };
+
+    // the outputs of both layouts are the ones of the models compiled for each of them alone
+    std::vector<ov::Tensor> references;
+    for (const auto mode : {ov::hint::PerformanceMode::LATENCY, ov::hint::PerformanceMode::THROUGHPUT}) {
+        auto reference = ie.compile_model(model, deviceName, ov::hint::performance_mode(mode)).create_infer_request();
+        references.push_back(infer(reference));
+    }
+    auto checkOutput = [&](const ov::Tensor& output) {
+        for (const auto& reference : references) {
+            ov::test::utils::compare(reference, output, 1e-5, 1e-5);
+        }
+    };
+
+    // enough requests to make the load switch the layout back and forth
+    const auto nireq = std::max(2u, compiledModel.get_property(ov::optimal_number_of_infer_requests));
+    std::vector<ov::InferRequest> requests;
+    for (unsigned int i = 0; i < nireq; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_input_tensor(input);
+    }
+    for (int iteration = 0; iteration < 32; iteration++) {
+        const auto active = iteration % 16 < 8 ? requests.size() : 1;
+        for (size_t i = 0; i < active; i++) {
+            ASSERT_NO_THROW(requests[i].start_async());
+        }
+        for (size_t i = 0; i < active; i++) {
+            ASSERT_NO_THROW(requests[i].wait());
+            checkOutput(requests[i].get_output_tensor());
+        }
+    }
+    checkOutput(infer(requests.front()));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckDynamicQuantization) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel;
+
+    ASSERT_NO_THROW(compiledModel = ie.compile_model(model, deviceName, ov::intel_cpu::dynamic_quantization(true)));
+    bool value = false;
+    ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::dynamic_quantization));
+    ASSERT_TRUE(value);
+
+    ov::InferRequest request;
+    ASSERT_NO_THROW(request = compiledModel.create_infer_request());
+    ASSERT_NO_THROW(request.infer());
+}
+
+// GridSample and the eltwise snippet are the kernels stored in the persistent cache
+std::shared_ptr<ov::Model> makeKernelCacheModel() {
+    auto data = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 3, 16, 16});
+    auto grid = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 8, 8, 2});
+    auto gridSample = std::make_shared<ov::opset9::GridSample>(data, grid, ov::opset9::GridSample::Attributes{});
+
+    auto addend = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 3, 16, 16});
+    auto add = std::make_shared<ov::opset9::Add>(data, addend);
+    auto scale = ov::opset9::Constant::create(ov::element::f32, ov::Shape{1}, {0.5f});
+    auto mul = std::make_shared<ov::opset9::Multiply>(add, scale);
+    auto sigmoid = std::make_shared<ov::opset9::Sigmoid>(mul);
+
+    return std::make_shared<ov::Model>(ov::NodeVector{gridSample, sigmoid},
+                                       ov::ParameterVector{data, grid, addend},
+                                       "KernelCacheModel");
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckKernelCache) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP() << "GridSample and snippets JIT kernels need AVX2";
+
+    const std::string cacheDir = "smoke_CpuExecNetworkCheckKernelCache";
+    ov::test::utils::removeFilesWithExt(cacheDir, "jitk");
+    ov::test::utils::removeDir(cacheDir);
+
+    auto cacheModel = makeKernelCacheModel();
+    std::vector<ov::Tensor> inputs;
+    for (const auto& input : cacheModel->inputs()) {
+        // the grid coordinates are normalized to [-1, 1]
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, input.get_shape(), 2, -1, 100));
+    }
+    auto infer = [&](ov::CompiledModel& compiledModel) {
+        auto request = compiledModel.create_infer_request();
+        for (size_t i = 0; i < inputs.size(); i++) {
+            request.set_input_tensor(i, inputs[i]);
+        }
+        request.infer();
+        std::vector<ov::Tensor> outputs;
+        for (size_t i = 0; i < compiledModel.outputs().size(); i++) {
+            outputs.push_back(request.get_output_tensor(i));
+        }
+        return outputs;
+    };
+
+    ov::Core refCore;
+    auto refModel = refCore.compile_model(cacheModel, deviceName);
+    const auto references = infer(refModel);
+
+#if defined(__linux__)
+    // the inode of a file changes when the kernel is stored again, so the same inodes mean the kernels are loaded
+    auto cachedFiles = [&] {
+        std::map<std::string, ino_t> files;
+        for (const auto& file : ov::test::utils::listFilesWithExt(cacheDir, "jitk")) {
+            struct stat st;
+            if (stat(file.c_str(), &st) == 0)
+                files[file] = st.st_ino;
+        }
+        return files;
+    };
+    std::map<std::string, ino_t> storedFiles;
+#endif
+
+    // the second compilation takes the kernels stored by the first one
+    for (size_t i = 0; i < 2; i++) {
+        ov::Core ie;
+        ov::CompiledModel compiledModel;
+        ASSERT_NO_THROW(compiledModel = ie.compile_model(cacheModel, deviceName, ov::intel_cpu::kernel_cache_dir(cacheDir)));
+        std::string value;
+        ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::kernel_cache_dir));
+        ASSERT_EQ(value, cacheDir);
+
+        const auto outputs = infer(compiledModel);
+        ASSERT_EQ(outputs.size(), references.size());
+        for (size_t j = 0; j < outputs.size(); j++) {
+            ov::test::utils::compare(references[j], outputs[j], 1e-6, 1e-6);
+        }
+
+#if defined(__linux__)
+        if (i == 0) {
+            storedFiles = cachedFiles();
+            ASSERT_FALSE(storedFiles.empty());
+        } else {
+            ASSERT_EQ(cachedFiles(), storedFiles);
+        }
+#endif
+    }
+
+    ov::test::utils::removeFilesWithExt(cacheDir, "jitk");
+    ov::test::utils::removeDir(cacheDir);
+}
+
+#if defined(__linux__)
+// file name -> content of the kernels stored in the directory
+std::map<std::string, std::string> readCachedKernels(const std::string& cacheDir) {
+    std::map<std::string, std::string> kernels;
+    for (const auto& file : ov::test::utils::listFilesWithExt(cacheDir, "jitk")) {
+        std::ifstream stream(file, std::ios::binary);
+        kernels[file.substr(cacheDir.size())] = std::string((std::istreambuf_iterator<char>(stream)),
+                                                            std::istreambuf_iterator<char>());
+    }
+    return kernels;
+}
+
+// the structured sparse weights (2:4 along K) run the SparseFc kernel
+std::shared_ptr<ov::Model> makeSparseFcKernelCacheModel() {
+    const size_t K = 64, N = 64;
+    std::vector<float> weights(K * N);
+    for (size_t k = 0; k < K; k++) {
+        for (size_t n = 0; n < N; n++) {
+            weights[k * N + n] = k % 4 < 2 ? 0.01f * static_cast<float>((k + n) % 7 + 1) : 0.f;
+        }
+    }
+    auto data = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{2, K});
+    auto weightsConst = ov::opset9::Constant::create(ov::element::f32, ov::Shape{K, N}, weights);
+    auto matMul = std::make_shared<ov::opset9::MatMul>(data, weightsConst);
+    return std::make_shared<ov::Model>(ov::NodeVector{matMul}, ov::ParameterVector{data}, "SparseFcKernelCache");
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckKernelCacheImagesDoNotDependOnAddress) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP() << "GridSample, snippets and SparseFc JIT kernels need AVX2";
+
+    // a rel32 call or jump out of the kernel is encoded relative to the kernel address: the kernels generated at
+    // two addresses by the two models alive at the same time would be stored as the different images
+    auto gridSampleModel = [] {
+        auto data = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 3, 16, 16});
+        auto grid = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 8, 8, 2});
+        auto gridSample = std::make_shared<ov::opset9::GridSample>(data, grid, ov::opset9::GridSample::Attributes{});
+        return std::make_shared<ov::Model>(ov::NodeVector{gridSample}, ov::ParameterVector{data, grid});
+    };
+    auto snippetModel = [] {
+        auto data = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 3, 16, 16});
+        auto addend = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 3, 16, 16});
+        auto add = std::make_shared<ov::opset9::Add>(data, addend);
+        auto scale = ov::opset9::Constant::create(ov::element::f32, ov::Shape{1}, {0.5f});
+        auto mul = std::make_shared<ov::opset9::Multiply>(add, scale);
+        auto sigmoid = std::make_shared<ov::opset9::Sigmoid>(mul);
+        return std::make_shared<ov::Model>(ov::NodeVector{sigmoid}, ov::ParameterVector{data, addend});
+    };
+    const std::vector<std::pair<std::string, std::shared_ptr<ov::Model>>> models = {
+        {"GridSample", gridSampleModel()},
+        {"Snippet", snippetModel()},
+        {"SparseFc", makeSparseFcKernelCacheModel()},
+    };
+
+    for (const auto& model : models) {
+        const std::string cacheDirs[2] = {"smoke_CpuKernelCacheImages_" + model.first + "_0",
+                                          "smoke_CpuKernelCacheImages_" + model.first + "_1"};
+        for (const auto& cacheDir : cacheDirs) {
+            ov::test::utils::removeFilesWithExt(cacheDir, "jitk");
+            ov::test::utils::removeDir(cacheDir);
+        }
+
+        std::vector<ov::CompiledModel> compiledModels;
+        for (const auto& cacheDir : cacheDirs) {
+            ov::Core ie;
+            ov::CompiledModel compiledModel;
+            ASSERT_NO_THROW(compiledModel = ie.compile_model(model.second, deviceName,
+                                                             ov::intel_cpu::kernel_cache_dir(cacheDir),
+                                                             ov::intel_cpu::sparse_weights_decompression_rate(0.4f),
+                                                             ov::hint::inference_precision(ov::element::f32)));
+            compiledModels.push_back(compiledModel);
+        }
+
+        const auto kernels = readCachedKernels(cacheDirs[0]);
+        ASSERT_FALSE(kernels.empty()) << model.first << " kernel is not stored";
+        ASSERT_EQ(readCachedKernels(cacheDirs[1]), kernels) << model.first << " kernel depends on its address";
+
+        compiledModels.clear();
+        for (const auto& cacheDir : cacheDirs) {
+            ov::test::utils::removeFilesWithExt(cacheDir, "jitk");
+            ov::test::utils::removeDir(cacheDir);
+        }
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckKernelCacheSkipsUntrustedFiles) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP() << "GridSample and snippets JIT kernels need AVX2";
+
+    const std::string cacheDir = "smoke_CpuExecNetworkCheckKernelCacheSkipsUntrustedFiles";
+    ov::test::utils::removeFilesWithExt(cacheDir, "jitk");
+    ov::test::utils::removeDir(cacheDir);
+    auto cacheModel = makeKernelCacheModel();
+    auto compile = [&] {
+        ov::Core ie;
+        ASSERT_NO_THROW(ie.compile_model(cacheModel, deviceName, ov::intel_cpu::kernel_cache_dir(cacheDir)));
+    };
+
+    // a file writable by the others is not loaded: the kernel is generated and the file is stored again
+    compile();
+    const auto files = ov::test::utils::listFilesWithExt(cacheDir, "jitk");
+    ASSERT_FALSE(files.empty());
+    std::map<std::string, ino_t> inodes;
+    for (const auto& file : files) {
+        struct stat st;
+        ASSERT_EQ(stat(file.c_str(), &st), 0);
+        inodes[file] = st.st_ino;
+        ASSERT_EQ(chmod(file.c_str(), 0666), 0);
+    }
+    compile();
+    for (const auto& file : files) {
+        struct stat st;
+        ASSERT_EQ(stat(file.c_str(), &st), 0);
+        ASSERT_NE(st.st_ino, inodes[file]);
+        ASSERT_EQ(st.st_mode & (S_IWGRP | S_IWOTH), 0);
+    }
+
+    // the cache is disabled for a directory writable by the others
+    ov::test::utils::removeFilesWithExt(cacheDir, "jitk");
+    ASSERT_EQ(chmod(cacheDir.c_str(), 0777), 0);
+    compile();
+    ASSERT_TRUE(ov::test::utils::listFilesWithExt(cacheDir, "jitk").empty());
+
+    ov::test::utils::removeDir(cacheDir);
+}
+#endif
+
 const auto bf16_if_can_be_emulated = InferenceEngine::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
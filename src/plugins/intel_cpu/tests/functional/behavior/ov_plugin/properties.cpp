@@ -32,6 +32,7 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RO_property(ov::range_for_streams.name()),
         RO_property(ov::device::full_name.name()),
         RO_property(ov::device::capabilities.name()),
+        RO_property(ov::intel_cpu::shared_weights_memory_size.name()),
         // read write
         RW_property(ov::num_streams.name()),
         RW_property(ov::affinity.name()),
@@ -47,6 +48,13 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::device::id.name()),
         RW_property(ov::intel_cpu::denormals_optimization.name()),
         RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RW_property(ov::intel_cpu::share_weights_across_models.name()),
+        RW_property(ov::intel_cpu::streams_auto_tune.name()),
+        RW_property(ov::intel_cpu::elastic_streams.name()),
+        RW_property(ov::intel_cpu::dynamic_quantization.name()),
+        RW_property(ov::intel_cpu::kernel_cache_dir.name()),
+        RW_property(ov::intel_cpu::kernel_cache_size.name()),
+        RW_property(ov::intel_cpu::layout_optimization.name()),
     };
 
     ov::Core ie;
@@ -5,6 +5,7 @@
 #include <vector>
 #include "single_layer_tests/ctc_greedy_decoder_seq_len.hpp"
 #include "common_test_utils/test_constants.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 
 using namespace LayerTestsDefinitions;
 using namespace ngraph::helpers;
@@ -47,4 +48,36 @@ INSTANTIATE_TEST_SUITE_P(smoke_set2, CTCGreedyDecoderSeqLenLayerTest,
                         ::testing::ValuesIn(mergeRepeated),
                         ::testing::Values(ov::test::utils::DEVICE_CPU)),
                     CTCGreedyDecoderSeqLenLayerTest::getTestCaseName);
+
+// long utterances, split between threads over time blocks
+INSTANTIATE_TEST_SUITE_P(smoke_set3, CTCGreedyDecoderSeqLenLayerTest,
+        ::testing::Combine(
+                        ::testing::ValuesIn(std::vector<std::vector<size_t>>{{1, 1000, 29}, {2, 3000, 100}}),
+                        ::testing::Values(3000),
+                        ::testing::Values(InferenceEngine::Precision::FP32),
+                        ::testing::Values(InferenceEngine::Precision::I32),
+                        ::testing::Values(0),
+                        ::testing::ValuesIn(mergeRepeated),
+                        ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                    CTCGreedyDecoderSeqLenLayerTest::getTestCaseName);
+
+struct CTCGreedyDecoderSeqLenBenchmarkTest : BenchmarkLayerTest<CTCGreedyDecoderSeqLenLayerTest> {};
+
+TEST_P(CTCGreedyDecoderSeqLenBenchmarkTest, DISABLED_CTCGreedyDecoderSeqLen_Benchmark) {
+    RunBenchmark("CTCGreedyDecoderSeqLen", std::chrono::milliseconds(2000), 1000);
+}
+
+INSTANTIATE_TEST_SUITE_P(CTCGreedyDecoderSeqLen, CTCGreedyDecoderSeqLenBenchmarkTest,
+        ::testing::Combine(
+                        ::testing::ValuesIn(std::vector<std::vector<size_t>>{{1, 1000, 1024},
+                                                                             {1, 5000, 1024},
+                                                                             {1, 10000, 1024},
+                                                                             {8, 10000, 29}}),
+                        ::testing::Values(10000),
+                        ::testing::Values(InferenceEngine::Precision::FP32),
+                        ::testing::Values(InferenceEngine::Precision::I32),
+                        ::testing::Values(0),
+                        ::testing::Values(true),
+                        ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                    CTCGreedyDecoderSeqLenLayerTest::getTestCaseName);
 }  // namespace
@@ -6,6 +6,7 @@
 
 #include "single_layer_tests/interpolate.hpp"
 #include "common_test_utils/test_constants.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 
 using namespace LayerTestsDefinitions;
 
@@ -192,4 +193,40 @@ INSTANTIATE_TEST_SUITE_P(smoke_Interpolate_Nearest_Down_Sample_Tail, Interpolate
         ::testing::Values(additional_config)),
     InterpolateLayerTest::getTestCaseName);
 
+// 2x upscaling of a planar image, as in super-resolution and segmentation heads
+const  std::vector<ngraph::op::v4::Interpolate::InterpolateMode> benchModes = {
+        ngraph::op::v4::Interpolate::InterpolateMode::NEAREST,
+        ngraph::op::v4::Interpolate::InterpolateMode::LINEAR_ONNX,
+        ngraph::op::v4::Interpolate::InterpolateMode::CUBIC,
+};
+
+struct InterpolateBenchmarkTest : BenchmarkLayerTest<InterpolateLayerTest> {};
+
+TEST_P(InterpolateBenchmarkTest, DISABLED_Interpolate_Benchmark) {
+    RunBenchmark("Interpolate", std::chrono::milliseconds(2000), 100);
+}
+
+INSTANTIATE_TEST_SUITE_P(Interpolate, InterpolateBenchmarkTest, ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(benchModes),
+            ::testing::Values(ngraph::op::v4::Interpolate::ShapeCalcMode::SIZES),
+            ::testing::Values(ngraph::op::v4::Interpolate::CoordinateTransformMode::HALF_PIXEL),
+            ::testing::ValuesIn(defaultNearestMode),
+            ::testing::ValuesIn(antialias),
+            ::testing::Values(std::vector<size_t>{0, 0, 0, 0}),
+            ::testing::Values(std::vector<size_t>{0, 0, 0, 0}),
+            ::testing::ValuesIn(cubeCoefs),
+            ::testing::ValuesIn(defaultAxes),
+            ::testing::Values(std::vector<float>{1.f, 1.f, 2.f, 2.f})),
+        ::testing::Values(InferenceEngine::Precision::FP32),
+        ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+        ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+        ::testing::Values(InferenceEngine::Layout::ANY),
+        ::testing::Values(InferenceEngine::Layout::ANY),
+        ::testing::Values(std::vector<size_t>{1, 3, 270, 480}),
+        ::testing::Values(std::vector<size_t>{1, 3, 540, 960}),
+        ::testing::Values(ov::test::utils::DEVICE_CPU),
+        ::testing::Values(additional_config)),
+    InterpolateLayerTest::getTestCaseName);
+
 } // namespace
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "single_layer_tests/pad.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 
 using namespace LayerTestsDefinitions;
 
@@ -156,4 +157,27 @@ INSTANTIATE_TEST_SUITE_P(
         PadLayerTest::getTestCaseName
 );
 
+struct PadBenchmarkTest : BenchmarkLayerTest<PadLayerTest> {};
+
+TEST_P(PadBenchmarkTest, DISABLED_Pad_Benchmark) {
+    RunBenchmark("Pad", std::chrono::milliseconds(2000), 100);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        Pad,
+        PadBenchmarkTest,
+        testing::Combine(
+                testing::Values(std::vector<int64_t>{0, 0, 8, 8}),
+                testing::Values(std::vector<int64_t>{0, 0, 8, 8}),
+                testing::Values(0),
+                testing::ValuesIn(padMode),
+                testing::Values(InferenceEngine::Precision::FP32),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(std::vector<size_t>{1, 32, 256, 256}),
+                testing::Values(ov::test::utils::DEVICE_CPU)),
+        PadLayerTest::getTestCaseName
+);
+
 }  // namespace
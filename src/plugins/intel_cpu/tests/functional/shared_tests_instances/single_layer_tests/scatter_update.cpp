@@ -2,10 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <numeric>
+#include <random>
 #include <vector>
 #include <ngraph/opsets/opset3.hpp>
 
 #include "single_layer_tests/scatter_update.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 #include "common_test_utils/test_constants.hpp"
 
 using namespace LayerTestsDefinitions;
@@ -46,4 +50,73 @@ const auto ScatterUpdateCase = ::testing::Combine(
 
 INSTANTIATE_TEST_SUITE_P(smoke_ScatterUpdate, ScatterUpdateLayerTest, ScatterUpdateCase, ScatterUpdateLayerTest::getTestCaseName);
 
+// Index distributions of embedding updates: a contiguous id range, sorted sparse ids and shuffled ids
+const size_t benchIndicesNum = 1024;
+
+std::vector<int64_t> contiguousIndices() {
+    std::vector<int64_t> indices(benchIndicesNum);
+    std::iota(indices.begin(), indices.end(), 4000);
+    return indices;
+}
+
+std::vector<int64_t> sortedSparseIndices() {
+    std::vector<int64_t> indices(benchIndicesNum);
+    for (size_t i = 0; i < indices.size(); i++) {
+        indices[i] = static_cast<int64_t>(i * 7 + i % 3);
+    }
+    return indices;
+}
+
+std::vector<int64_t> shuffledIndices() {
+    auto indices = sortedSparseIndices();
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(0));
+    return indices;
+}
+
+// rows of an embedding table (large blocks) and columns of a batch of features (single element blocks)
+const std::vector<axisUpdateShapeInShape> benchShapes = {
+    axisUpdateShapeInShape{{10000, 64}, {benchIndicesNum}, {benchIndicesNum, 64}, 0},
+    axisUpdateShapeInShape{{64, 10000}, {benchIndicesNum}, {64, benchIndicesNum}, 1},
+};
+
+std::string getBenchTestCaseName(const testing::TestParamInfo<scatterUpdateParamsTuple>& obj) {
+    // the indices values are named by the test suite
+    const auto& shapes = std::get<0>(obj.param);
+    std::ostringstream result;
+    result << "InputShape=" << ov::test::utils::vec2str(std::get<0>(shapes)) << "_";
+    result << "Axis=" << std::get<3>(shapes) << "_";
+    result << "inPrc=" << std::get<2>(obj.param).name();
+    return result.str();
+}
+
+struct ScatterUpdateBenchmarkTest : BenchmarkLayerTest<ScatterUpdateLayerTest> {};
+
+TEST_P(ScatterUpdateBenchmarkTest, DISABLED_ScatterUpdate_Benchmark) {
+    RunBenchmark("ScatterUpdate", std::chrono::milliseconds(2000), 1000);
+}
+
+INSTANTIATE_TEST_SUITE_P(ScatterUpdate_Contiguous, ScatterUpdateBenchmarkTest,
+                         ::testing::Combine(::testing::ValuesIn(benchShapes),
+                                            ::testing::Values(contiguousIndices()),
+                                            ::testing::Values(InferenceEngine::Precision::FP32),
+                                            ::testing::Values(InferenceEngine::Precision::I32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         getBenchTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(ScatterUpdate_SortedSparse, ScatterUpdateBenchmarkTest,
+                         ::testing::Combine(::testing::ValuesIn(benchShapes),
+                                            ::testing::Values(sortedSparseIndices()),
+                                            ::testing::Values(InferenceEngine::Precision::FP32),
+                                            ::testing::Values(InferenceEngine::Precision::I32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         getBenchTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(ScatterUpdate_Shuffled, ScatterUpdateBenchmarkTest,
+                         ::testing::Combine(::testing::ValuesIn(benchShapes),
+                                            ::testing::Values(shuffledIndices()),
+                                            ::testing::Values(InferenceEngine::Precision::FP32),
+                                            ::testing::Values(InferenceEngine::Precision::I32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         getBenchTestCaseName);
+
 }  // namespace
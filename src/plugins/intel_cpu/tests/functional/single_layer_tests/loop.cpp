@@ -466,6 +466,31 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForCommon, LoopLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// static shapes: the merged input exchanges the buffers with the body output instead of copying
+std::vector<int64_t> static_trip_count { 1, 5 };
+std::vector<std::vector<InputShape>> static_inputs = {
+    {
+        {{}, {{1, 1, 10}}},
+        {{}, {{1, 1, 10}}},
+        {{}, {{1, 1, 10}}},
+    },
+    {
+        {{}, {{5, 1, 3}}},
+        {{}, {{5, 1, 3}}},
+        {{}, {{5, 1, 3}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopForCommonStatic, LoopLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(InputLayerType::CONSTANT),
+                                 ::testing::ValuesIn(static_trip_count),
+                                 ::testing::Values(true),
+                                 ::testing::ValuesIn(static_inputs),
+                                 ::testing::Values(types),
+                                 ::testing::ValuesIn(inputPrecisions)),
+                         LoopLayerCPUTest::getTestCaseName);
+
 std::vector<std::vector<InputShape>> inputs_2 = {
     {  //first test suit
         {   //dynamic shape
@@ -119,6 +119,7 @@ protected:
             1lu;
         if (inputDynamicShapes.size() > 3) {
             if (!inputDynamicShapes[3].is_dynamic() &&
+                    seqMode != ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_PARAM &&
                     seqMode != ngraph::helpers::SequenceTestsMode::CONVERT_TO_TI_MAX_SEQ_LEN_PARAM &&
                     seqMode != ngraph::helpers::SequenceTestsMode::CONVERT_TO_TI_RAND_SEQ_LEN_PARAM) {
                 params.pop_back();
@@ -143,7 +144,8 @@ protected:
 
         function = makeNgraphFunction(netPrecision, params, lstmSequenceOp, "lstmSequenceOp");
 
-        if (seqMode != ngraph::helpers::SequenceTestsMode::PURE_SEQ) {
+        randomSeqLengths = seqMode == ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_PARAM;
+        if (seqMode != ngraph::helpers::SequenceTestsMode::PURE_SEQ && !randomSeqLengths) {
             ov::pass::Manager manager;
             if (direction == ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL)
                 manager.register_pass<ov::pass::BidirectionalLSTMSequenceDecomposition>();
@@ -170,8 +172,15 @@ protected:
 
             auto lenData = seqLenInput->second.data<ov::element_type_traits<ElementType::i64>::value_type>();
             std::fill(lenData, lenData + batchSize, maxSeqLen);
+            if (randomSeqLengths) {
+                // ragged batch: the lengths differ within the batch, some of them repeat
+                for (size_t i = 0; i < batchSize; i++)
+                    lenData[i] = maxSeqLen - static_cast<int64_t>(i % 3) % maxSeqLen;
+            }
         }
     }
+
+    bool randomSeqLengths = false;
 };
 
 TEST_P(LSTMSequenceCPUTest, CompareWithRefs) {
@@ -392,6 +401,30 @@ INSTANTIATE_TEST_SUITE_P(smoke_dynamic_batch, LSTMSequenceCPUTest,
                                ::testing::Values(std::map<std::string, std::string>{{"_dynamic_batch_test", "yes"}})),
             LSTMSequenceCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_dynamic_variable_lengths, LSTMSequenceCPUTest,
+            ::testing::Combine(::testing::ValuesIn({dynamicShapes[0], dynamicShapes[1], dynamicShapes[2]}),
+                               ::testing::Values(ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_PARAM),
+                               ::testing::ValuesIn(activations),
+                               ::testing::ValuesIn(clip),
+                               ::testing::Values(ov::op::RecurrentSequenceDirection::FORWARD,
+                                                 ov::op::RecurrentSequenceDirection::REVERSE),
+                               ::testing::ValuesIn(netPrecisions),
+                               ::testing::Values(cpuParams),
+                               ::testing::Values(std::map<std::string, std::string>{})),
+            LSTMSequenceCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_variable_lengths, LSTMSequenceCPUTest,
+                ::testing::Combine(::testing::ValuesIn(std::vector<std::vector<InputShape>>{staticShapes[0], staticShapes[1]}),
+                                   ::testing::Values(ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_PARAM),
+                                   ::testing::ValuesIn(activations),
+                                   ::testing::ValuesIn(clip),
+                                   ::testing::Values(ov::op::RecurrentSequenceDirection::FORWARD,
+                                                     ov::op::RecurrentSequenceDirection::REVERSE),
+                                   ::testing::ValuesIn(netPrecisions),
+                                   ::testing::Values(cpuParams),
+                                   ::testing::Values(std::map<std::string, std::string>{})),
+                LSTMSequenceCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_dynamic, LSTMSequenceCPUTest,
             ::testing::Combine(::testing::ValuesIn({dynamicShapes[0], dynamicShapes[1], dynamicShapes[2]}),
                                ::testing::ValuesIn(mode),
@@ -151,5 +151,24 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple, TensorIteratorCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+// the outer dimensions are 1, so the body reads and writes the chunks of the external tensors in place
+std::vector<std::vector<InputShape>> static_inputs = {
+    {
+        {{}, {{1, 12, 10}}},
+        {{}, {{1, 12, 1}}},
+    },
+    {
+        {{}, {{3, 5, 2}}},
+        {{}, {{1, 5, 2}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorStatic, TensorIteratorCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(static_inputs),
+                                 ::testing::ValuesIn(direction),
+                                 ::testing::ValuesIn(inputPrecisions)),
+                         TensorIteratorCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
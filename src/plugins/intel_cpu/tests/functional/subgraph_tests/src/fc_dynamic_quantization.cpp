@@ -0,0 +1,148 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include <openvino/runtime/intel_cpu/properties.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+/*
+ *    Data(F32)   Weights(F32)
+ *          \      /
+ *           MatMul
+ *             |
+ *          Bias(opt)
+ *
+ * With CPU_DYNAMIC_QUANTIZATION the FullyConnected quantizes the activations per token at runtime
+ * and runs in int8 on platforms with VNNI.
+ */
+using FCDynamicQuantizationParams = std::tuple<std::vector<InputShape>,  // input shapes
+                                               bool,                      // with bias
+                                               ov::AnyMap>;               // additional config
+
+class FCDynamicQuantization : public testing::WithParamInterface<FCDynamicQuantizationParams>,
+                              virtual public SubgraphBaseTest,
+                              public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCDynamicQuantizationParams> obj) {
+        std::vector<InputShape> inputShapes;
+        bool withBias;
+        ov::AnyMap additionalConfig;
+        std::tie(inputShapes, withBias, additionalConfig) = obj.param;
+
+        std::ostringstream result;
+        for (const auto& shape : inputShapes) {
+            result << ov::test::utils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : inputShapes) {
+            result << "(";
+            for (const auto& item : shape.second) {
+                result << ov::test::utils::vec2str(item) << "_";
+            }
+            result << ")_";
+        }
+        result << "bias=" << withBias << "_";
+        result << "config=(";
+        for (const auto& configEntry : additionalConfig) {
+            result << configEntry.first << ", " << configEntry.second.as<std::string>() << ":";
+        }
+        result << ")";
+        return result.str();
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& param = function->inputs()[0];
+        // activations in [-1, 1) so that the absolute threshold does not depend on the shape much
+        auto tensor = ov::test::utils::create_and_fill_tensor(param.get_element_type(), targetInputStaticShapes[0], 2, -1, 256);
+        inputs.insert({param.get_node_shared_ptr(), tensor});
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        std::vector<InputShape> inputShapes;
+        bool withBias;
+        ov::AnyMap additionalConfig;
+        std::tie(inputShapes, withBias, additionalConfig) = GetParam();
+
+        configuration.insert(additionalConfig.begin(), additionalConfig.end());
+        configuration.insert(ov::intel_cpu::dynamic_quantization(true));
+        init_input_shapes(inputShapes);
+
+        const auto netType = element::f32;
+        inType = outType = netType;
+        auto params = builder::makeDynamicParams(netType, {inputDynamicShapes[0]});
+        auto weights = builder::makeConstant<float>(netType, inputShapes[1].second[0], {}, true, 1.f, -1.f);
+        std::shared_ptr<ov::Node> result = builder::makeMatMul(params[0], weights);
+        if (withBias) {
+            const auto outputChannels = inputShapes[1].second[0].back();
+            auto bias = builder::makeConstant<float>(netType, {1, outputChannels}, {}, true, 1.f, -1.f);
+            result = std::make_shared<ov::opset10::Add>(result, bias);
+        }
+        function = makeNgraphFunction(netType, params, result, "FCDynamicQuantization");
+
+        // per-token activations and per-channel weights are quantized to 8 bits
+        abs_threshold = 0.25f;
+    }
+
+    void checkResults() {
+        // the quantized path is only taken when int8 dot products are fast
+        const bool expectInt8 = with_cpu_x86_avx512_core_vnni() || with_cpu_x86_avx2_vnni();
+        size_t fcCount = 0;
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            const auto& rtInfo = n->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            fcCount++;
+            const auto runtimePrecision = rtInfo.at(ExecGraphInfoSerialization::RUNTIME_PRECISION).as<std::string>();
+            if (expectInt8) {
+                ASSERT_EQ(runtimePrecision, "I8");
+            } else {
+                ASSERT_NE(runtimePrecision, "I8");
+            }
+        }
+        ASSERT_EQ(fcCount, 1);
+    }
+};
+
+TEST_P(FCDynamicQuantization, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    checkResults();
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {{{}, {{4, 64}}}, {{}, {{64, 32}}}},
+    {{{}, {{1, 7, 256}}}, {{}, {{256, 128}}}},
+    {{{-1, -1, 512}, {{1, 1, 512}, {2, 9, 512}, {1, 1, 512}}}, {{}, {{512, 96}}}},
+};
+
+std::vector<ov::AnyMap> filterAdditionalConfig() {
+    std::vector<ov::AnyMap> additionalConfig{{}};
+    if (with_cpu_x86_avx512_core())
+        additionalConfig.push_back({ov::hint::inference_precision(ov::element::bf16)});
+    return additionalConfig;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCDynamicQuantization,
+                         FCDynamicQuantization,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(false, true),
+                                            ::testing::ValuesIn(filterAdditionalConfig())),
+                         FCDynamicQuantization::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,192 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include <random>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+/*
+ *    Data(F32)   Weights(F32, sparse)
+ *          \      /
+ *           MatMul
+ *             |
+ *          Bias(opt)
+ *
+ * With CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE the FullyConnected with the structured sparse weights (2:4, 4:8 or
+ * zero blocks) runs the sparse kernel on the platforms with AVX2 or AVX-512 and without AMX.
+ */
+enum class WeightsSparsity { DENSE, NM_2_4, NM_4_8, BLOCKS };
+
+using FCStructuredSparsityParams = std::tuple<std::vector<InputShape>,  // input shapes
+                                              WeightsSparsity,
+                                              bool,                      // with bias
+                                              ov::AnyMap>;               // additional config
+
+class FCStructuredSparsity : public testing::WithParamInterface<FCStructuredSparsityParams>,
+                             virtual public SubgraphBaseTest,
+                             public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCStructuredSparsityParams> obj) {
+        std::vector<InputShape> inputShapes;
+        WeightsSparsity sparsity;
+        bool withBias;
+        ov::AnyMap additionalConfig;
+        std::tie(inputShapes, sparsity, withBias, additionalConfig) = obj.param;
+
+        std::ostringstream result;
+        for (const auto& shape : inputShapes) {
+            result << ov::test::utils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : inputShapes) {
+            result << "(";
+            for (const auto& item : shape.second) {
+                result << ov::test::utils::vec2str(item) << "_";
+            }
+            result << ")_";
+        }
+        result << "sparsity=" << static_cast<int>(sparsity) << "_";
+        result << "bias=" << withBias << "_";
+        result << "config=(";
+        for (const auto& configEntry : additionalConfig) {
+            result << configEntry.first << ", " << configEntry.second.as<std::string>() << ":";
+        }
+        result << ")";
+        return result.str();
+    }
+
+protected:
+    // weights [K, N], the pattern is along K for every output channel
+    static std::vector<float> makeWeights(size_t K, size_t N, WeightsSparsity sparsity) {
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> dist(0.1f, 1.f);
+        std::vector<float> weights(K * N);
+        for (size_t k = 0; k < K; k++) {
+            for (size_t n = 0; n < N; n++) {
+                bool nonZero = true;
+                switch (sparsity) {
+                case WeightsSparsity::NM_2_4:
+                    nonZero = k % 4 == (n + k / 4) % 4 || k % 4 == (n + k / 4 + 2) % 4;
+                    break;
+                case WeightsSparsity::NM_4_8:
+                    // 4 consecutive positions (cyclic), so some groups of 4 are dense
+                    nonZero = (k % 8 + 8 - (n + k / 8) % 8) % 8 < 4;
+                    break;
+                case WeightsSparsity::BLOCKS:
+                    // the dense blocks of 16 output and 8 input channels
+                    nonZero = (k / 8 + n / 16) % 2 == 0;
+                    break;
+                default:
+                    break;
+                }
+                const float value = dist(gen);
+                weights[k * N + n] = nonZero ? (gen() % 2 ? value : -value) : 0.f;
+            }
+        }
+        return weights;
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        std::vector<InputShape> inputShapes;
+        bool withBias;
+        ov::AnyMap additionalConfig;
+        std::tie(inputShapes, sparsity, withBias, additionalConfig) = GetParam();
+
+        configuration.insert(additionalConfig.begin(), additionalConfig.end());
+        configuration.insert(ov::intel_cpu::sparse_weights_decompression_rate(0.4f));
+        init_input_shapes(inputShapes);
+
+        const auto netType = element::f32;
+        inType = outType = netType;
+        auto params = builder::makeDynamicParams(netType, {inputDynamicShapes[0]});
+        const auto& weightsShape = inputShapes[1].second[0];
+        auto weights = builder::makeConstant<float>(netType, weightsShape,
+                                                    makeWeights(weightsShape[0], weightsShape[1], sparsity));
+        std::shared_ptr<ov::Node> result = builder::makeMatMul(params[0], weights);
+        if (withBias) {
+            auto bias = builder::makeConstant<float>(netType, {1, weightsShape[1]}, {}, true, 1.f, -1.f);
+            result = std::make_shared<ov::opset10::Add>(result, bias);
+        }
+        function = makeNgraphFunction(netType, params, result, "FCStructuredSparsity");
+
+        const auto it = additionalConfig.find(ov::hint::inference_precision.name());
+        inferenceBF16 = it != additionalConfig.end() && it->second.as<ov::element::Type>() == ov::element::bf16;
+        if (inferenceBF16)
+            rel_threshold = 0.05f;
+    }
+
+    void checkResults() {
+        // the dense bf16 AMX inner product is preferred over the sparse kernel
+        const bool expectSparse = sparsity != WeightsSparsity::DENSE && with_cpu_x86_avx2() &&
+                                  !(inferenceBF16 && with_cpu_x86_avx512_core_amx_bf16());
+        size_t fcCount = 0;
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            const auto& rtInfo = n->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            fcCount++;
+            const auto primType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            if (expectSparse) {
+                ASSERT_TRUE(primType == "jit_sparse_avx512" || primType == "jit_sparse_avx2") << primType;
+            } else {
+                ASSERT_EQ(primType.find("jit_sparse"), std::string::npos) << primType;
+            }
+        }
+        ASSERT_EQ(fcCount, 1);
+    }
+
+    WeightsSparsity sparsity = WeightsSparsity::DENSE;
+    bool inferenceBF16 = false;
+};
+
+TEST_P(FCStructuredSparsity, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    checkResults();
+}
+
+namespace {
+
+// N not multiple of the channels block and M not multiple of the rows block are covered
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {{{}, {{4, 64}}}, {{}, {{64, 32}}}},
+    {{{}, {{1, 7, 256}}}, {{}, {{256, 136}}}},
+    {{{-1, -1, 512}, {{1, 1, 512}, {2, 9, 512}, {1, 1, 512}}}, {{}, {{512, 96}}}},
+};
+
+const std::vector<WeightsSparsity> sparsities = {
+    WeightsSparsity::DENSE,
+    WeightsSparsity::NM_2_4,
+    WeightsSparsity::NM_4_8,
+    WeightsSparsity::BLOCKS,
+};
+
+std::vector<ov::AnyMap> filterAdditionalConfig() {
+    std::vector<ov::AnyMap> additionalConfig{{}};
+    if (with_cpu_x86_avx512_core())
+        additionalConfig.push_back({ov::hint::inference_precision(ov::element::bf16)});
+    return additionalConfig;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCStructuredSparsity,
+                         FCStructuredSparsity,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(sparsities),
+                                            ::testing::Values(false, true),
+                                            ::testing::ValuesIn(filterAdditionalConfig())),
+                         FCStructuredSparsity::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
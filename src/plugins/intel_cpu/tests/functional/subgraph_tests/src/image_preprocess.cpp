@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include <openvino/core/preprocess/pre_post_process.hpp>
+#include <openvino/opsets/opset1.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+/*
+ *   Param (Y)    Param (UV)
+ *        \         /
+ *      Convert  Convert
+ *          \     /
+ *         NV12toRGB           (or I420toRGB of three planes)
+ *             |
+ *        Interpolate
+ *             |
+ *     Subtract (mean)
+ *             |
+ *      Divide (scale)
+ *             |
+ *   Transpose (NHWC -> NCHW)
+ *             |
+ *            Relu
+ *             |
+ *           Result
+ *
+ * The chain built by PrePostProcessor is fused into a single ImagePreprocess node. Its results are compared with the
+ * reference of the separate operations.
+ */
+using ImagePreprocessParams = std::tuple<ov::preprocess::ColorFormat,      // planes format
+                                         ov::preprocess::ResizeAlgorithm,  // resize
+                                         bool>;                            // convert to f32 before the color conversion
+
+class ImagePreprocessCPUTest : public testing::WithParamInterface<ImagePreprocessParams>,
+                               virtual public SubgraphBaseTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ImagePreprocessParams>& obj) {
+        ov::preprocess::ColorFormat colorFormat;
+        ov::preprocess::ResizeAlgorithm resizeAlgorithm;
+        bool convertFirst;
+        std::tie(colorFormat, resizeAlgorithm, convertFirst) = obj.param;
+
+        std::ostringstream result;
+        result << (colorFormat == ov::preprocess::ColorFormat::NV12_TWO_PLANES ? "NV12" : "I420") << "_";
+        result << (resizeAlgorithm == ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR ? "linear" : "nearest") << "_";
+        result << (convertFirst ? "f32_planes" : "u8_planes");
+        return result.str();
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            // the whole range of the pixel values
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[i].get_element_type(),
+                                                                  targetInputStaticShapes[i], 255, 0, 1);
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::preprocess::ColorFormat colorFormat;
+        ov::preprocess::ResizeAlgorithm resizeAlgorithm;
+        bool convertFirst;
+        std::tie(colorFormat, resizeAlgorithm, convertFirst) = this->GetParam();
+
+        // the fused kernel blends the pixels in another order than the reference
+        abs_threshold = 1e-3f;
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+
+        auto params = ngraph::builder::makeParams(ov::element::f32, {{1, 3, 224, 224}});
+        params[0]->set_friendly_name("image");
+        params[0]->get_output_tensor(0).set_names({"image"});
+        auto relu = std::make_shared<ov::opset1::Relu>(params[0]);
+        auto model = std::make_shared<ov::Model>(relu->outputs(), params, "ImagePreprocess");
+
+        ov::preprocess::PrePostProcessor ppp(model);
+        ppp.input().tensor()
+            .set_element_type(ov::element::u8)
+            .set_color_format(colorFormat)
+            .set_spatial_static_shape(480, 640);
+        auto& steps = ppp.input().preprocess();
+        if (convertFirst) {
+            steps.convert_element_type(ov::element::f32).convert_color(ov::preprocess::ColorFormat::RGB);
+        } else {
+            steps.convert_color(ov::preprocess::ColorFormat::RGB).convert_element_type(ov::element::f32);
+        }
+        steps.resize(resizeAlgorithm)
+            .mean({123.675f, 116.28f, 103.53f})
+            .scale({58.395f, 57.12f, 57.375f});
+        ppp.input().model().set_layout("NCHW");
+        function = ppp.build();
+
+        std::vector<ov::Shape> planeShapes;
+        for (const auto& param : function->get_parameters()) {
+            planeShapes.push_back(param->get_shape());
+        }
+        init_input_shapes(static_shapes_to_test_representation(planeShapes));
+    }
+};
+
+TEST_P(ImagePreprocessCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ImagePreprocess", 1);
+    CheckNumberOfNodesWithType(compiledModel, "ColorConvert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Interpolate", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ImagePreprocess,
+                         ImagePreprocessCPUTest,
+                         ::testing::Combine(::testing::Values(ov::preprocess::ColorFormat::NV12_TWO_PLANES,
+                                                              ov::preprocess::ColorFormat::I420_THREE_PLANES),
+                                            ::testing::Values(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR,
+                                                              ov::preprocess::ResizeAlgorithm::RESIZE_NEAREST),
+                                            ::testing::Values(true, false)),
+                         ImagePreprocessCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
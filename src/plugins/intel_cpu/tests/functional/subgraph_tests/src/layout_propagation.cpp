@@ -0,0 +1,102 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <ie_system_conf.h>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+/*
+ *          Param (nchw)
+ *               |
+ *             Relu
+ *            /    \
+ *         Conv    Conv    (nhwc with AVX-512, nChw8c with AVX2)
+ *          |        |
+ *       Result    Result
+ *
+ * The greedy selection gives Relu the planar layout of its input, so both convolutions read it through a reorder.
+ * The layouts refinement switches Relu to the layout of the convolutions, so a single reorder is left on its input.
+ */
+using LayoutPropagationParams = bool;  // layout optimization
+
+class LayoutPropagationTest : public testing::WithParamInterface<LayoutPropagationParams>,
+                              virtual public SubgraphBaseTest,
+                              public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<LayoutPropagationParams> obj) {
+        std::ostringstream result;
+        result << "layoutOptimization=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        layoutOptimization = GetParam();
+
+        configuration.insert(ov::intel_cpu::layout_optimization(layoutOptimization));
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+        configuration.insert({PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigInternalParams::DISABLE});
+
+        const auto netType = element::f32;
+        init_input_shapes({{{}, {{1, 32, 20, 20}}}});
+        auto params = builder::makeDynamicParams(netType, inputDynamicShapes);
+        auto relu = builder::makeActivation(params[0], netType, helpers::ActivationTypes::Relu);
+
+        ResultVector results;
+        for (size_t i = 0; i < 2; i++) {
+            auto conv = builder::makeConvolution(relu, netType, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 op::PadType::EXPLICIT, 32);
+            results.push_back(std::make_shared<opset1::Result>(conv));
+        }
+        function = std::make_shared<ov::Model>(results, params, "LayoutPropagation");
+
+        // the brgconv nspc implementation is preferred with AVX-512, the jit blocked one with AVX2
+        const auto convFmt = with_cpu_x86_avx512_core() ? nhwc : nChw8c;
+        outFmts = {layoutOptimization ? convFmt : nchw};
+        selectedType = CPUTestsBase::any_type;
+    }
+
+    bool layoutOptimization = true;
+};
+
+TEST_P(LayoutPropagationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!with_cpu_x86_avx2())
+        GTEST_SKIP() << "The convolutions layouts are checked for AVX2 and AVX-512";
+
+    run();
+
+    CheckPluginRelatedResults(compiledModel, "Eltwise");
+    // the reorders on the convolutions outputs to the planar results are left in both cases
+    CheckNumberOfNodesWithType(compiledModel, "Reorder", layoutOptimization ? 3 : 4);
+
+    const auto statistics = compiledModel.get_property(ov::intel_cpu::reorder_statistics);
+    if (layoutOptimization) {
+        ASSERT_LT(statistics.at("after:reorders"), statistics.at("before:reorders"));
+        ASSERT_LT(statistics.at("after:bytes"), statistics.at("before:bytes"));
+    } else {
+        ASSERT_EQ(statistics.at("after:reorders"), statistics.at("before:reorders"));
+        ASSERT_EQ(statistics.at("after:bytes"), statistics.at("before:bytes"));
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_LayoutPropagation,
+                         LayoutPropagationTest,
+                         ::testing::Values(true, false),
+                         LayoutPropagationTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <exec_graph_info.hpp>
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "openvino/runtime/core.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+/*
+ *            Param
+ *              |
+ *        Conv + Relu
+ *         /        \
+ *    MaxPool     Conv + Sigmoid
+ *        |          |
+ *      Conv      AvgPool
+ *         \        /
+ *          Concat
+ *            |
+ *          MVN
+ *            |
+ *          Result
+ *
+ * The descriptors of the nodes are enumerated and their primitives are created concurrently. The compiled graph and
+ * its outputs must not depend on it: they are compared with a compilation on a single thread.
+ */
+namespace {
+std::shared_ptr<ov::Model> makeParallelCompilationModel() {
+    const auto type = element::f32;
+    auto params = builder::makeParams(type, {{1, 16, 32, 32}});
+    auto conv1 = builder::makeConvolution(params[0], type, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                          op::PadType::EXPLICIT, 32);
+    auto relu = builder::makeActivation(conv1, type, helpers::ActivationTypes::Relu);
+
+    auto maxPool = builder::makePooling(relu, {2, 2}, {0, 0}, {0, 0}, {2, 2}, op::RoundingType::FLOOR,
+                                        op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+    auto conv2 = builder::makeConvolution(maxPool, type, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                          op::PadType::EXPLICIT, 16);
+
+    auto conv3 = builder::makeConvolution(relu, type, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                          op::PadType::EXPLICIT, 16);
+    auto sigmoid = builder::makeActivation(conv3, type, helpers::ActivationTypes::Sigmoid);
+    auto avgPool = builder::makePooling(sigmoid, {2, 2}, {0, 0}, {0, 0}, {2, 2}, op::RoundingType::FLOOR,
+                                        op::PadType::EXPLICIT, false, helpers::PoolingTypes::AVG);
+
+    auto concat = std::make_shared<opset1::Concat>(OutputVector{conv2, avgPool}, 1);
+    auto mvn = builder::makeMVN(concat, false, true, 1e-9);
+    return std::make_shared<ov::Model>(std::make_shared<opset1::Result>(mvn), params, "ParallelCompilation");
+}
+
+// node name -> type, implementation, layouts and precision of the compiled graph
+std::map<std::string, std::string> getRuntimeDescriptors(const ov::CompiledModel& compiledModel) {
+    std::map<std::string, std::string> descriptors;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ordered_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto getExecValue = [&rtInfo](const std::string& paramName) {
+            auto it = rtInfo.find(paramName);
+            return it == rtInfo.end() ? std::string{} : it->second.as<std::string>();
+        };
+        descriptors[node->get_friendly_name()] = getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) + "/" +
+                                                 getExecValue(ExecGraphInfoSerialization::IMPL_TYPE) + "/" +
+                                                 getExecValue(ExecGraphInfoSerialization::OUTPUT_LAYOUTS) + "/" +
+                                                 getExecValue(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+    }
+    return descriptors;
+}
+}  // namespace
+
+TEST(ParallelCompilationTest, smoke_SameGraphAsSerialCompilation) {
+    ov::Core core;
+    const auto model = makeParallelCompilationModel();
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, model->input().get_shape(), 10, -5, 100);
+    auto infer = [&](ov::CompiledModel& compiledModel) {
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor();
+    };
+
+    // graphs are created on the streams, a single stream of a single thread compiles the nodes one by one
+    auto serialModel = core.compile_model(model, ov::test::utils::DEVICE_CPU,
+                                          ov::num_streams(1),
+                                          ov::inference_num_threads(1),
+                                          ov::hint::inference_precision(ov::element::f32));
+    const auto serialDescriptors = getRuntimeDescriptors(serialModel);
+    const auto serialOutput = infer(serialModel);
+
+    for (size_t i = 0; i < 5; i++) {
+        auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU,
+                                                ov::num_streams(1),
+                                                ov::hint::inference_precision(ov::element::f32));
+        ASSERT_EQ(getRuntimeDescriptors(compiledModel), serialDescriptors);
+        ov::test::utils::compare(serialOutput, infer(compiledModel), 1e-5, 1e-5);
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
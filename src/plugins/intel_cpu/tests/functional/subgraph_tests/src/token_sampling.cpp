@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/opsets/opset11.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+/*
+ *        Param (logits)
+ *             |
+ *      Divide (temperature)
+ *             |
+ *          Softmax
+ *             |
+ *           TopK
+ *          /    \
+ *     Result    Result
+ *
+ * Divide, Softmax and TopK are fused into a single TokenSampling node.
+ */
+using TokenSamplingParams = std::tuple<InputShape,  // logits shape
+                                       size_t,      // k
+                                       float>;      // temperature
+
+class TokenSamplingCPUTest : public testing::WithParamInterface<TokenSamplingParams>,
+                             virtual public SubgraphBaseTest,
+                             public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TokenSamplingParams>& obj) {
+        InputShape inputShape;
+        size_t k;
+        float temperature;
+        std::tie(inputShape, k, temperature) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << ov::test::utils::vec2str(shape) << "_";
+        }
+        result << "k=" << k << "_";
+        result << "temperature=" << temperature;
+        return result.str();
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& modelInputs = function->inputs();
+        const auto& shape = targetInputStaticShapes[0];
+        ov::Tensor tensor(modelInputs[0].get_element_type(), shape);
+
+        // the logits of a row are distinct, so the selected indices do not depend on the order of equal values
+        const size_t vocab = shape.back();
+        std::vector<float> row(vocab);
+        std::mt19937 gen(0);
+        auto* data = tensor.data<float>();
+        for (size_t offset = 0; offset < tensor.get_size(); offset += vocab) {
+            std::iota(row.begin(), row.end(), 0.f);
+            std::shuffle(row.begin(), row.end(), gen);
+            std::transform(row.begin(), row.end(), data + offset, [vocab](float v) {
+                return 16.f * v / vocab - 8.f;
+            });
+        }
+        inputs.insert({modelInputs[0].get_node_shared_ptr(), tensor});
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        InputShape inputShape;
+        size_t k;
+        float temperature;
+        std::tie(inputShape, k, temperature) = this->GetParam();
+
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto temperatureConst = ov::opset1::Constant::create(ov::element::f32, {}, {temperature});
+        auto scaled = std::make_shared<ov::opset1::Divide>(params[0], temperatureConst);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(scaled, -1);
+        auto kConst = ov::opset1::Constant::create(ov::element::i64, {}, {k});
+        auto topk = std::make_shared<ov::opset11::TopK>(softmax,
+                                                        kConst,
+                                                        -1,
+                                                        ov::op::TopKMode::MAX,
+                                                        ov::op::TopKSortType::SORT_VALUES,
+                                                        ov::element::i32);
+
+        ov::ResultVector results{std::make_shared<ov::opset1::Result>(topk->output(0)),
+                                 std::make_shared<ov::opset1::Result>(topk->output(1))};
+        function = std::make_shared<ov::Model>(results, params, "TokenSampling");
+    }
+};
+
+TEST_P(TokenSamplingCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "TokenSampling", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Softmax", 0);
+    CheckNumberOfNodesWithType(compiledModel, "TopK", 0);
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 100}}},
+    {{}, {{2, 3, 1000}}},
+    // long rows are split between threads
+    {{}, {{1, 32000}}},
+    {{-1, -1}, {{1, 5000}, {4, 32000}, {1, 5000}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TokenSampling,
+                         TokenSamplingCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(1, 5, 50),
+                                            ::testing::Values(1.f, 0.7f)),
+                         TokenSamplingCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
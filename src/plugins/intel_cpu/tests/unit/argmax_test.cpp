@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "nodes/common/argmax.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+int referenceArgmax(const std::vector<float>& data) {
+    int maxIdx = 0;
+    for (size_t i = 1; i < data.size(); i++) {
+        if (data[i] > data[maxIdx])
+            maxIdx = static_cast<int>(i);
+    }
+    return maxIdx;
+}
+}   // namespace
+
+TEST(ArgmaxTests, MatchesSequentialScan) {
+    std::mt19937 gen(42);
+    // a narrow value range produces many equal maxima, which must resolve to the first occurrence
+    std::uniform_int_distribution<int> dist(0, 7);
+    for (int size : {1, 2, 15, 16, 31, 32, 33, 100, 1000, 4097}) {
+        for (int iter = 0; iter < 20; iter++) {
+            std::vector<float> data(size);
+            for (auto& v : data)
+                v = static_cast<float>(dist(gen));
+            ASSERT_EQ(argmax(data.data(), size), referenceArgmax(data)) << "size " << size;
+        }
+    }
+}
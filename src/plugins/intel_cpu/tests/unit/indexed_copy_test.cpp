@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <random>
+
+#include "nodes/common/indexed_copy.h"
+
+using namespace ov::intel_cpu;
+
+TEST(IndexedCopyTests, GatherRunsMergesConsecutiveBlocks) {
+    std::vector<int32_t> src(64);
+    std::iota(src.begin(), src.end(), 0);
+
+    // blocks of 4 elements: a sequential run, a repeated block and a backward jump
+    const std::vector<size_t> srcBlocks{2, 3, 4, 4, 0, 1};
+    std::vector<int32_t> dst(srcBlocks.size() * 4, -1);
+    size_t calls = 0;
+    gatherRuns(dst.data(), src.data(), 4, 0, srcBlocks.size(), [&](size_t i) {
+        calls++;
+        return srcBlocks[i] * 4;
+    });
+
+    ASSERT_EQ(calls, srcBlocks.size());
+    for (size_t i = 0; i < srcBlocks.size(); i++) {
+        for (size_t j = 0; j < 4; j++) {
+            ASSERT_EQ(dst[i * 4 + j], static_cast<int32_t>(srcBlocks[i] * 4 + j));
+        }
+    }
+}
+
+TEST(IndexedCopyTests, ScatterRunsLastUpdateWins) {
+    const size_t blockSize = 2 * sizeof(float);
+    const size_t blocksNum = 100000;
+    std::vector<float> dst(blocksNum * 2, 0.f);
+
+    // every destination block is updated twice, the second update must be the visible one
+    std::vector<size_t> dstOffsets(2 * blocksNum);
+    std::vector<float> update(2 * blocksNum * 2);
+    for (size_t i = 0; i < 2 * blocksNum; i++) {
+        dstOffsets[i] = (i % blocksNum) * blockSize;
+        update[2 * i] = update[2 * i + 1] = static_cast<float>(i);
+    }
+
+    ScatterRunsBuffers buffers;
+    scatterRuns(reinterpret_cast<uint8_t*>(dst.data()), reinterpret_cast<const uint8_t*>(update.data()),
+                blockSize, dst.size() * sizeof(float), dstOffsets, buffers);
+
+    for (size_t b = 0; b < blocksNum; b++) {
+        ASSERT_EQ(dst[2 * b], static_cast<float>(blocksNum + b));
+        ASSERT_EQ(dst[2 * b + 1], static_cast<float>(blocksNum + b));
+    }
+}
+
+TEST(IndexedCopyTests, ScatterRunsMatchesSerialScatter) {
+    const size_t blockSize = sizeof(int32_t);
+    const size_t blocksNum = 50000;
+    const size_t updatesNum = 4 * blocksNum;
+
+    // random destinations with duplicates, interleaved with sorted runs
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<size_t> dist(0, blocksNum - 1);
+    std::vector<size_t> dstOffsets(updatesNum);
+    std::vector<int32_t> update(updatesNum);
+    for (size_t i = 0; i < updatesNum; i++) {
+        dstOffsets[i] = (i % 1000 < 500 ? i % blocksNum : dist(gen)) * blockSize;
+        update[i] = static_cast<int32_t>(i);
+    }
+
+    std::vector<int32_t> expected(blocksNum, -1);
+    for (size_t i = 0; i < updatesNum; i++) {
+        expected[dstOffsets[i] / blockSize] = update[i];
+    }
+
+    // the buffers are reused by the second scatter
+    ScatterRunsBuffers buffers;
+    for (size_t iteration = 0; iteration < 2; iteration++) {
+        std::vector<int32_t> dst(blocksNum, -1);
+        scatterRuns(reinterpret_cast<uint8_t*>(dst.data()), reinterpret_cast<const uint8_t*>(update.data()),
+                    blockSize, dst.size() * sizeof(int32_t), dstOffsets, buffers);
+        ASSERT_EQ(dst, expected);
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "utils/shape_inference/shape_inference_memoized.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// doubles the last dimension of the first input and reports it as pads, so that stale pads are detectable
+class CountingShapeInfer : public IShapeInfer {
+public:
+    Result infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        calls++;
+        auto dims = input_shapes.front().get();
+        dims.back() *= 2;
+        pads = ov::CoordinateDiff{static_cast<std::ptrdiff_t>(dims.back())};
+        return {{dims}, ShapeInferStatus::success};
+    }
+    const ov::CoordinateDiff& get_pads_begin() override { return pads; }
+    const ov::CoordinateDiff& get_pads_end() override { return pads; }
+    port_mask_t get_port_mask() const override { return EMPTY_PORT_MASK; }
+
+    size_t calls = 0;
+    ov::CoordinateDiff pads;
+};
+
+IShapeInfer::Result inferDims(IShapeInfer& shapeInfer, const VectorDims& dims) {
+    return shapeInfer.infer({std::cref(dims)}, {});
+}
+} // namespace
+
+TEST(MemoizedShapeInferTests, ReusesResultForSameInputDims) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    MemoizedShapeInfer memoized(counting, 4);
+
+    const VectorDims dims{1, 3, 8};
+    for (size_t i = 0; i < 10; i++) {
+        auto result = inferDims(memoized, dims);
+        ASSERT_EQ(result.status, ShapeInferStatus::success);
+        ASSERT_EQ(result.dims, std::vector<VectorDims>{VectorDims({1, 3, 16})});
+    }
+
+    ASSERT_EQ(counting->calls, 1u);
+    ASSERT_EQ(memoized.misses(), 1u);
+    ASSERT_EQ(memoized.hits(), 9u);
+}
+
+TEST(MemoizedShapeInferTests, EvictsLeastRecentlyUsed) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    MemoizedShapeInfer memoized(counting, 2);
+
+    inferDims(memoized, {1, 1});
+    inferDims(memoized, {1, 2});
+    inferDims(memoized, {1, 1});    // hit, {1, 2} becomes the least recently used entry
+    inferDims(memoized, {1, 3});    // evicts {1, 2}
+    ASSERT_EQ(counting->calls, 3u);
+
+    inferDims(memoized, {1, 1});
+    ASSERT_EQ(counting->calls, 3u);
+    inferDims(memoized, {1, 2});
+    ASSERT_EQ(counting->calls, 4u);
+}
+
+TEST(MemoizedShapeInferTests, PadsFollowLastInferredShape) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    MemoizedShapeInfer memoized(counting, 4);
+
+    inferDims(memoized, {1, 5});
+    inferDims(memoized, {1, 7});
+    ASSERT_EQ(memoized.get_pads_begin(), ov::CoordinateDiff{14});
+
+    // cache hit must not leave the pads of the previous shape
+    inferDims(memoized, {1, 5});
+    ASSERT_EQ(counting->calls, 2u);
+    ASSERT_EQ(memoized.get_pads_begin(), ov::CoordinateDiff{10});
+    ASSERT_EQ(memoized.get_pads_end(), ov::CoordinateDiff{10});
+}
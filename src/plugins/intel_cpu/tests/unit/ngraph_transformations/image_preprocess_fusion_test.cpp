@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <openvino/core/model.hpp>
+#include <openvino/core/preprocess/pre_post_process.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/pass/manager.hpp>
+#include <transformations/cpu_opset/common/pass/image_preprocess_fusion.hpp>
+#include <transformations/cpu_opset/common/op/image_preprocess.hpp>
+#include <transformations/init_node_info.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::Model> create_model(const ov::PartialShape& shape) {
+    auto data = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+    data->set_friendly_name("input");
+    data->get_output_tensor(0).set_names({"input"});
+    auto relu = std::make_shared<ov::opset1::Relu>(data);
+    return std::make_shared<ov::Model>(relu->outputs(), ov::ParameterVector{data});
+}
+
+void run_fusion(const std::shared_ptr<ov::Model>& model) {
+    ov::pass::Manager m;
+    m.register_pass<ov::pass::InitNodeInfo>();
+    m.register_pass<ImagePreprocessFusion>();
+    m.run_passes(model);
+}
+
+std::shared_ptr<ImagePreprocessNode> get_preprocess(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& node : model->get_ordered_ops()) {
+        if (const auto preprocess = ov::as_type_ptr<ImagePreprocessNode>(node))
+            return preprocess;
+    }
+    return nullptr;
+}
+}   // namespace
+
+TEST(TransformationTests, ImagePreprocessFusionNV12ResizeMeanScale) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        f = create_model(ov::Shape{1, 3, 224, 224});
+        ov::preprocess::PrePostProcessor ppp(f);
+        ppp.input().tensor()
+            .set_element_type(ov::element::u8)
+            .set_color_format(ov::preprocess::ColorFormat::NV12_TWO_PLANES, {"y", "uv"})
+            .set_spatial_static_shape(720, 1280);
+        ppp.input().preprocess()
+            .convert_element_type(ov::element::f32)
+            .convert_color(ov::preprocess::ColorFormat::RGB)
+            .resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR)
+            .mean({10.f, 20.f, 30.f})
+            .scale(2.f);
+        ppp.input().model().set_layout("NCHW");
+        f = ppp.build();
+        run_fusion(f);
+    }
+
+    {
+        auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{1, 720, 1280, 1});
+        auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{1, 360, 640, 2});
+        ImagePreprocessNode::Attributes attrs;
+        attrs.color_format = "NV12";
+        attrs.resize_mode = "linear";
+        attrs.target_size = {224, 224};
+        attrs.scale = {0.5f, 0.5f, 0.5f};
+        attrs.shift = {-5.f, -10.f, -15.f};
+        attrs.nchw_output = true;
+        auto preprocess = std::make_shared<ImagePreprocessNode>(ov::OutputVector{y, uv}, attrs);
+        auto relu = std::make_shared<ov::opset1::Relu>(preprocess);
+
+        f_ref = std::make_shared<ov::Model>(relu->outputs(), ov::ParameterVector{y, uv});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    const auto preprocess = get_preprocess(f);
+    ASSERT_NE(preprocess, nullptr);
+    const auto& attrs = preprocess->get_attrs();
+    ASSERT_FALSE(attrs.round_color);
+    ASSERT_EQ(attrs.target_size, (std::vector<int64_t>{224, 224}));
+    ASSERT_EQ(attrs.scale, (std::vector<float>{0.5f, 0.5f, 0.5f}));
+    ASSERT_EQ(attrs.shift, (std::vector<float>{-5.f, -10.f, -15.f}));
+}
+
+TEST(TransformationTests, ImagePreprocessFusionResizeToDynamicModelShape) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        f = create_model(ov::PartialShape{1, 3, -1, -1});
+        ov::preprocess::PrePostProcessor ppp(f);
+        ppp.input().tensor()
+            .set_element_type(ov::element::u8)
+            .set_color_format(ov::preprocess::ColorFormat::NV12_TWO_PLANES, {"y", "uv"})
+            .set_spatial_static_shape(2160, 3840);
+        ppp.input().preprocess()
+            .convert_element_type(ov::element::f32)
+            .convert_color(ov::preprocess::ColorFormat::RGB)
+            .resize(ov::preprocess::ResizeAlgorithm::RESIZE_NEAREST);
+        ppp.input().model().set_layout("NCHW");
+        f = ppp.build();
+        run_fusion(f);
+    }
+
+    {
+        auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{1, 2160, 3840, 1});
+        auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{1, 1080, 1920, 2});
+        auto size = std::make_shared<ov::opset1::Parameter>(ov::element::i64, ov::Shape{2});
+        ImagePreprocessNode::Attributes attrs;
+        attrs.color_format = "NV12";
+        attrs.resize_mode = "nearest";
+        attrs.nchw_output = true;
+        auto preprocess = std::make_shared<ImagePreprocessNode>(ov::OutputVector{y, uv, size}, attrs);
+        auto relu = std::make_shared<ov::opset1::Relu>(preprocess);
+
+        f_ref = std::make_shared<ov::Model>(relu->outputs(), ov::ParameterVector{y, uv, size});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(f->get_parameters()[2]->get_friendly_name(), "input/resize_size");
+}
+
+TEST(TransformationTests, ImagePreprocessFusionResizeOnly) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        f = create_model(ov::Shape{1, 3, 224, 224});
+        ov::preprocess::PrePostProcessor ppp(f);
+        ppp.input().tensor()
+            .set_element_type(ov::element::u8)
+            .set_layout("NHWC")
+            .set_spatial_static_shape(2160, 3840);
+        ppp.input().preprocess()
+            .convert_element_type(ov::element::f32)
+            .resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR);
+        ppp.input().model().set_layout("NCHW");
+        f = ppp.build();
+        f_ref = f->clone();
+        run_fusion(f);
+    }
+
+    // no color conversion: the resize is left to the Interpolate node
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(get_preprocess(f), nullptr);
+}
+
+TEST(TransformationTests, ImagePreprocessFusionMeanScaleOnly) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        f = create_model(ov::Shape{1, 3, 224, 224});
+        ov::preprocess::PrePostProcessor ppp(f);
+        ppp.input().tensor().set_element_type(ov::element::u8);
+        ppp.input().preprocess().convert_element_type(ov::element::f32).mean(128.f).scale(255.f);
+        f = ppp.build();
+        f_ref = f->clone();
+        run_fusion(f);
+    }
+
+    // no color conversion: the eltwise chain is left to the other fusions
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(get_preprocess(f), nullptr);
+}
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/opsets/opset11.hpp>
+#include <openvino/pass/manager.hpp>
+#include <transformations/cpu_opset/common/pass/token_sampling_fusion.hpp>
+#include <transformations/cpu_opset/common/op/token_sampling.hpp>
+#include <transformations/init_node_info.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST(TransformationTests, TokenSamplingFusionGreedy) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, -1, 32000});
+        auto softmax = std::make_shared<ov::opset8::Softmax>(logits, -1);
+        auto k = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {1});
+        auto topk = std::make_shared<ov::opset11::TopK>(softmax, k, -1, "max", "value", ov::element::i32);
+
+        f = std::make_shared<ov::Model>(topk->outputs(), ov::ParameterVector{logits});
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<TokenSamplingFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, -1, 32000});
+        auto sampling = std::make_shared<TokenSamplingNode>(logits, 1, 1.f, ov::element::i32);
+
+        f_ref = std::make_shared<ov::Model>(sampling->outputs(), ov::ParameterVector{logits});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TokenSamplingFusionTemperature) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{4, 50257});
+        auto temperature = ov::opset1::Constant::create(ov::element::f32, ov::Shape{1}, {0.7f});
+        auto scaled = std::make_shared<ov::opset1::Divide>(logits, temperature);
+        auto softmax = std::make_shared<ov::opset1::Softmax>(scaled, 1);
+        auto k = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {50});
+        auto topk = std::make_shared<ov::opset1::TopK>(softmax, k, 1, "max", "value", ov::element::i32);
+
+        f = std::make_shared<ov::Model>(topk->outputs(), ov::ParameterVector{logits});
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<TokenSamplingFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{4, 50257});
+        auto sampling = std::make_shared<TokenSamplingNode>(logits, 50, 0.7f, ov::element::i32);
+
+        f_ref = std::make_shared<ov::Model>(sampling->outputs(), ov::ParameterVector{logits});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TokenSamplingFusionSoftmaxHasOtherConsumers) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 32000});
+        auto softmax = std::make_shared<ov::opset8::Softmax>(logits, -1);
+        auto k = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {5});
+        auto topk = std::make_shared<ov::opset11::TopK>(softmax, k, -1, "max", "value", ov::element::i32);
+
+        f = std::make_shared<ov::Model>(ov::OutputVector{topk->output(0), topk->output(1), softmax}, ov::ParameterVector{logits});
+        f_ref = f->clone();
+
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<TokenSamplingFusion>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TokenSamplingFusionNotInnermostAxis) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{32000, 2});
+        auto softmax = std::make_shared<ov::opset8::Softmax>(logits, 0);
+        auto k = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {5});
+        auto topk = std::make_shared<ov::opset11::TopK>(softmax, k, 0, "max", "value", ov::element::i32);
+
+        f = std::make_shared<ov::Model>(topk->outputs(), ov::ParameterVector{logits});
+        f_ref = f->clone();
+
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<TokenSamplingFusion>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
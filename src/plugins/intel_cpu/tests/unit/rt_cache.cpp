@@ -379,3 +379,36 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SharedCacheConcurrentAccess) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+    constexpr size_t numThreads = 30;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        // the keys range exceeds the capacity, so records are evicted and recreated concurrently
+        for (int i = 0; i < 10 * capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i % (2 * capacity)}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i % (2 * capacity));
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(*intResult.first, i);
+    }
+}
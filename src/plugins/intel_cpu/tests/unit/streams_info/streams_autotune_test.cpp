@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common_test_utils/test_common.hpp>
+
+#include "cpu_streams_autotune.hpp"
+
+using namespace testing;
+using namespace ov;
+
+namespace {
+
+struct StreamsTuneCandidatesTestCase {
+    int model_prefer_threads;
+    std::vector<std::vector<int>> proc_type_table;
+    std::vector<int> threads_per_stream;
+};
+
+class StreamsTuneCandidatesTests : public ov::test::TestsCommon,
+                                   public testing::WithParamInterface<std::tuple<StreamsTuneCandidatesTestCase>> {
+public:
+    void SetUp() override {
+        auto test_data = std::get<0>(GetParam());
+
+        const auto test_result =
+            ov::intel_cpu::get_streams_tune_threads_per_stream(test_data.model_prefer_threads,
+                                                               test_data.proc_type_table);
+
+        ASSERT_EQ(test_data.threads_per_stream, test_result);
+    }
+};
+
+StreamsTuneCandidatesTestCase _2sockets_104cores_default = {
+    0,
+    {{208, 104, 0, 104}, {104, 52, 0, 52}, {104, 52, 0, 52}},
+    {0, 1, 2, 4, 8, 16, 32},
+};
+
+StreamsTuneCandidatesTestCase _1sockets_8cores_prefer_2 = {
+    2,
+    {{16, 8, 0, 8}},
+    {2, 1, 4, 8},
+};
+
+StreamsTuneCandidatesTestCase _1sockets_6cores_prefer_3 = {
+    3,
+    {{12, 6, 0, 6}},
+    {3, 1, 2, 4},
+};
+
+StreamsTuneCandidatesTestCase _1sockets_ecores_only = {
+    1,
+    {{4, 0, 4, 0}},
+    {1},
+};
+
+TEST_P(StreamsTuneCandidatesTests, StreamsTuneCandidates) {}
+
+INSTANTIATE_TEST_SUITE_P(StreamsTuneCandidates,
+                         StreamsTuneCandidatesTests,
+                         testing::Values(_2sockets_104cores_default,
+                                         _1sockets_8cores_prefer_2,
+                                         _1sockets_6cores_prefer_3,
+                                         _1sockets_ecores_only));
+
+TEST(StreamsTuneTests, HeuristicLayoutIsKeptWithinNoise) {
+    const std::vector<std::vector<int>> proc_type_table = {{16, 8, 0, 8}};
+    // every candidate is 1% faster than the heuristic one
+    auto trial = [](const ov::intel_cpu::StreamsTuneCandidate& candidate) {
+        return candidate.threads_per_stream == 2 ? 100.0 : 101.0;
+    };
+
+    const auto best = ov::intel_cpu::tune_streams(2, true, true, proc_type_table, trial);
+    ASSERT_EQ(2, best.threads_per_stream);
+    ASSERT_TRUE(best.cpu_pinning);
+}
+
+TEST(StreamsTuneTests, FastestLayoutIsSelected) {
+    const std::vector<std::vector<int>> proc_type_table = {{16, 8, 0, 8}};
+    std::vector<ov::intel_cpu::StreamsTuneCandidate> probed;
+    auto trial = [&](const ov::intel_cpu::StreamsTuneCandidate& candidate) {
+        probed.push_back(candidate);
+        double fps = candidate.threads_per_stream == 4 ? 150.0 : 100.0;
+        return candidate.cpu_pinning ? fps : fps * 1.2;
+    };
+
+    const auto best = ov::intel_cpu::tune_streams(2, true, true, proc_type_table, trial);
+    ASSERT_EQ(4, best.threads_per_stream);
+    ASSERT_FALSE(best.cpu_pinning);
+    // the pinning is probed for the best threads per stream only
+    ASSERT_EQ(5, probed.size());
+
+    probed.clear();
+    const auto pinned = ov::intel_cpu::tune_streams(2, true, false, proc_type_table, trial);
+    ASSERT_EQ(4, pinned.threads_per_stream);
+    ASSERT_TRUE(pinned.cpu_pinning);
+    ASSERT_EQ(4, probed.size());
+}
+
+}  // namespace
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "cpu_streams_elastic.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// the compiled LATENCY layout has a single wide stream, the alternative THROUGHPUT layout has 8 narrow streams
+constexpr int wide_layout = 0;
+constexpr int narrow_layout = 1;
+
+TEST(ElasticStreamsSelectorTest, SwitchesToNarrowLayoutUnderPersistentLoad) {
+    ElasticStreamsSelector selector(1, 8);
+    ASSERT_EQ(selector.get_active_layout(), wide_layout);
+
+    // a single pending request fits the wide stream
+    ASSERT_EQ(selector.acquire(), wide_layout);
+    for (int vote = 1; vote < ElasticStreamsSelector::votes_to_switch; vote++) {
+        ASSERT_EQ(selector.acquire(), wide_layout) << "switched after " << vote << " votes";
+    }
+    ASSERT_EQ(selector.acquire(), narrow_layout);
+    ASSERT_EQ(selector.get_active_layout(), narrow_layout);
+
+    // the requests are drained one by one, each of them is alone again and votes for the wide layout
+    for (int pending = 1 + ElasticStreamsSelector::votes_to_switch; pending > 0; pending--) {
+        selector.release();
+    }
+    for (int vote = 1; vote < ElasticStreamsSelector::votes_to_switch; vote++) {
+        ASSERT_EQ(selector.acquire(), narrow_layout) << "switched back after " << vote << " votes";
+        selector.release();
+    }
+    ASSERT_EQ(selector.acquire(), wide_layout);
+    selector.release();
+    ASSERT_EQ(selector.get_active_layout(), wide_layout);
+}
+
+TEST(ElasticStreamsSelectorTest, ShortBurstKeepsLayout) {
+    ElasticStreamsSelector selector(1, 8);
+
+    ASSERT_EQ(selector.acquire(), wide_layout);
+    for (int vote = 1; vote < ElasticStreamsSelector::votes_to_switch; vote++) {
+        ASSERT_EQ(selector.acquire(), wide_layout);
+    }
+    // the burst is over before it collected enough votes
+    for (int pending = ElasticStreamsSelector::votes_to_switch; pending > 0; pending--) {
+        selector.release();
+    }
+    ASSERT_EQ(selector.acquire(), wide_layout);
+    ASSERT_EQ(selector.get_active_layout(), wide_layout);
+}
+
+TEST(ElasticStreamsSelectorTest, CompiledNarrowLayout) {
+    // the compiled THROUGHPUT layout is the narrow one, the wide layout is the alternative
+    ElasticStreamsSelector selector(8, 1);
+    ASSERT_EQ(selector.get_active_layout(), 0);
+
+    // the narrow layout is active, a lone request calls for the wide one
+    for (int vote = 1; vote < ElasticStreamsSelector::votes_to_switch; vote++) {
+        ASSERT_EQ(selector.acquire(), 0);
+        selector.release();
+    }
+    ASSERT_EQ(selector.acquire(), 1);
+    ASSERT_EQ(selector.get_active_layout(), 1);
+}
+
+}  // namespace
@@ -43,6 +43,20 @@ test_data_fp32_sync = get_tests \
      )
 
 
+# the rate is not set, so the SLO search estimates its upper bound and the measured run uses the found rate
+test_data_fp32_slo = get_tests \
+    (cmd_params={'i': [os.path.join('227x227', 'dog.bmp')],
+                 'm': [os.path.join('squeezenet1.1', 'FP32', 'squeezenet1.1.xml')],
+                 'batch': [1],
+                 'sample_type': ['C++'],
+                 'd': ['CPU'],
+                 'api': ['async'],
+                 'load_mode': ['poisson'],
+                 'slo_p99': ['1000'],
+                 't': ['1']},
+     use_device=['d']
+     )
+
 
 class TestBenchmarkApp(SamplesCommonTestClass):
     @classmethod
@@ -60,6 +74,14 @@ class TestBenchmarkApp(SamplesCommonTestClass):
     def test_benchmark_app_fp32_sync(self, param):
         _check_output(self, param)
 
+    @pytest.mark.parametrize("param", test_data_fp32_slo)
+    def test_benchmark_app_fp32_slo(self, param):
+        stdout = self._test(param)
+        if not stdout:
+            return 0
+        assert 'Maximum rate under the P99 latency SLO' in stdout, "No rate found by the SLO search"
+        assert 'End-to-end latency' in stdout, "No open-loop latency distribution in output"
+
 
 def _check_output(self, param):
     """